@@ -0,0 +1,605 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains a binary file format for graphs and its read-only view.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRIO_BIN_GRAPH_HPP
+#define GRIO_BIN_GRAPH_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "mmap_file.hpp"
+#include "../ugraph/bit_utils.hpp"
+#include "../ugraph/csr_lbl_ugraph.hpp"
+
+
+namespace bin_graph_details {
+
+/*! ****************************************************************************
+ *  \brief Header of a binary graph file.
+ *
+ *  The file is made of the header and the sections following it at 64-byte
+ *  aligned positions: offsets of the adjacency lists (verticesNum + 1 of
+ *  uint64), concatenated adjacency lists (adjNum of uint32), optionally the
+ *  edge labels parallel to them (adjNum of labelSize bytes), the vertex
+ *  dictionary (verticesNum of vertexSize bytes, original vertices by dense
+ *  ids) and, for a reordered graph, the vertex index (verticesNum of uint32,
+ *  dense ids ordered by their vertices). Numbers are stored in the byte
+ *  order of the host, which is checked by the magic number.
+ *
+ *  Version 2 added the vertex index; files without it are still written as
+ *  version 1, so that older readers open them.
+ ******************************************************************************/
+struct Header {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t flags;            ///< HAS_LABELS | HAS_VERTICES | HAS_VERTEX_INDEX.
+    std::uint32_t labelSize;        ///< 0 if there are no labels.
+    std::uint32_t vertexSize;       ///< 0 if there is no vertex dictionary.
+    std::uint32_t reserved;
+    std::uint64_t verticesNum;
+    std::uint64_t edgesNum;
+    std::uint64_t adjNum;           ///< Total length of adjacency lists.
+    std::uint64_t offsetsPos;
+    std::uint64_t adjPos;
+    std::uint64_t labelsPos;
+    std::uint64_t verticesPos;
+    std::uint64_t fileSize;
+    std::uint64_t checksum;         ///< Of all the bytes after the header.
+};
+
+static_assert(sizeof(Header) == 96, "Unexpected padding of the header");
+
+const std::uint32_t FILE_MAGIC = 0x47424755;        ///< "UGBG"
+const std::uint32_t FILE_VERSION = 2;
+const std::uint32_t HAS_LABELS = 1;
+const std::uint32_t HAS_VERTICES = 2;
+const std::uint32_t HAS_VERTEX_INDEX = 4;       ///< Follows the vertex dictionary.
+const size_t SECTION_ALIGN = 64;
+
+inline std::uint64_t alignPos(std::uint64_t pos)
+{
+    return (pos + SECTION_ALIGN - 1) / SECTION_ALIGN * SECTION_ALIGN;
+}
+
+/// Returns the position of the vertex index, which has no field in the header.
+inline std::uint64_t getIndexPos(const Header& h)
+{
+    return alignPos(h.verticesPos + h.verticesNum * h.vertexSize);
+}
+
+/// Fills the positions of the sections and the size of the file.
+inline void layOut(Header& h)
+{
+    h.offsetsPos = alignPos(sizeof(Header));
+    h.adjPos = alignPos(h.offsetsPos + (h.verticesNum + 1) * sizeof(std::uint64_t));
+    std::uint64_t end = h.adjPos + h.adjNum * sizeof(std::uint32_t);
+    h.labelsPos = (h.flags & HAS_LABELS) ? alignPos(end) : 0;
+    if(h.flags & HAS_LABELS)
+        end = h.labelsPos + h.adjNum * h.labelSize;
+    h.verticesPos = (h.flags & HAS_VERTICES) ? alignPos(end) : 0;
+    if(h.flags & HAS_VERTICES)
+        end = h.verticesPos + h.verticesNum * h.vertexSize;
+    if(h.flags & HAS_VERTEX_INDEX)
+        end = getIndexPos(h) + h.verticesNum * sizeof(std::uint32_t);
+    h.fileSize = end;
+}
+
+/*! ****************************************************************************
+ *  \brief Streaming 64-bit checksum of the file body.
+ *
+ *  Four independent multiply-rotate lanes over 32-byte blocks (as in
+ *  xxHash64), so that checking a large file runs at memory speed. Not
+ *  cryptographic: it detects truncation and corruption, not tampering.
+ ******************************************************************************/
+class Checksum {
+public:
+    Checksum()
+        : _lanes{P1 + P2, P2, 0, 0 - P1}, _tailSize(0), _length(0)
+    {
+    }
+
+    void update(const char* data, size_t n)
+    {
+        _length += n;
+        if(_tailSize)
+        {
+            size_t k = std::min(n, BLOCK - _tailSize);
+            std::memcpy(_tail + _tailSize, data, k);
+            _tailSize += k;
+            data += k;
+            n -= k;
+            if(_tailSize < BLOCK)
+                return;
+            processBlock(_tail);
+            _tailSize = 0;
+        }
+        for(; n >= BLOCK; data += BLOCK, n -= BLOCK)
+            processBlock(data);
+        std::memcpy(_tail, data, n);
+        _tailSize = n;
+    }
+
+    std::uint64_t get() const
+    {
+        Checksum c = *this;
+        if(c._tailSize)
+        {
+            std::memset(c._tail + c._tailSize, 0, BLOCK - c._tailSize);
+            c.processBlock(c._tail);
+        }
+        std::uint64_t h = rotl(c._lanes[0], 1) + rotl(c._lanes[1], 7)
+                          + rotl(c._lanes[2], 12) + rotl(c._lanes[3], 18);
+        return bits::mix64(h ^ _length);
+    }
+
+protected:
+    static const std::uint64_t P1 = 0x9e3779b185ebca87ULL;
+    static const std::uint64_t P2 = 0xc2b2ae3d27d4eb4fULL;
+    static const size_t BLOCK = 32;
+
+    static std::uint64_t rotl(std::uint64_t x, unsigned r)
+    {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    void processBlock(const char* p)
+    {
+        for(int i = 0; i < 4; ++i)
+        {
+            std::uint64_t w;
+            std::memcpy(&w, p + i * 8, 8);
+            _lanes[i] = rotl(_lanes[i] + w * P2, 31) * P1;
+        }
+    }
+
+protected:
+    std::uint64_t _lanes[4];
+    char _tail[BLOCK];
+    size_t _tailSize;
+    std::uint64_t _length;
+}; // class Checksum
+
+/// Writes blocks to a file computing their checksum.
+class Writer {
+public:
+    /// Opens the file \a fn leaving room for the header.
+    explicit Writer(const std::string& fn)
+        : _out(fn, std::ios::binary), _pos(sizeof(Header))
+    {
+        if(!_out)
+            throw std::invalid_argument("Can't open file for a binary graph");
+
+        Header empty = Header();
+        _out.write(reinterpret_cast<const char*>(&empty), sizeof(empty));
+    }
+
+    void write(const void* data, size_t n)
+    {
+        _out.write(static_cast<const char*>(data), static_cast<std::streamsize>(n));
+        _sum.update(static_cast<const char*>(data), n);
+        _pos += n;
+    }
+
+    /// Pads the file with zeros up to the position \a pos.
+    void padTo(std::uint64_t pos)
+    {
+        static const char zeros[SECTION_ALIGN] = {0};
+        write(zeros, static_cast<size_t>(pos - _pos));
+    }
+
+    /// Writes the header at the beginning of the file with the checksum of
+    /// everything written after it.
+    void finish(Header& h)
+    {
+        h.checksum = _sum.get();
+        _out.seekp(0);
+        _out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+        _out.flush();
+        if(!_out)
+            throw std::invalid_argument("Can't write a binary graph");
+    }
+
+protected:
+    std::ofstream _out;
+    Checksum _sum;
+    std::uint64_t _pos;
+}; // class Writer
+
+/// Writes the sections of a CSR graph, with \a labelSize byte labels at
+/// \a labels if \a labelSize is not 0.
+template <typename Vertex>
+void save(const std::string& fn, const CsrUGraph<Vertex>& g, const void* labels,
+          std::uint32_t labelSize)
+{
+    static_assert(std::is_trivially_copyable<Vertex>::value,
+                  "Vertices must be trivially copyable to be saved");
+
+    Header h = Header();
+    h.magic = FILE_MAGIC;
+    h.version = 1;
+    h.verticesNum = g.getVerticesNum();
+    h.edgesNum = g.getEdgesNum();
+    h.adjNum = g.getAdjOffset(static_cast<typename CsrUGraph<Vertex>::VId>(h.verticesNum));
+
+    // dense ids 0..n-1 of integer vertices need no dictionary
+    bool identity = std::is_integral<Vertex>::value;
+    for(std::uint64_t v = 0; identity && v < h.verticesNum; ++v)
+        identity = static_cast<std::uint64_t>(g.getVertex(static_cast<std::uint32_t>(v))) == v;
+    if(labelSize)
+    {
+        h.flags |= HAS_LABELS;
+        h.labelSize = labelSize;
+    }
+    if(!identity)
+    {
+        h.flags |= HAS_VERTICES;
+        h.vertexSize = sizeof(Vertex);
+    }
+    if(!g.getVertexIndex().empty())
+    {
+        h.flags |= HAS_VERTEX_INDEX;
+        h.version = 2;
+    }
+    layOut(h);
+
+    Writer out(fn);
+    out.padTo(h.offsetsPos);
+    std::vector<std::uint64_t> buf;
+    const size_t BUF_SIZE = 1 << 16;
+    for(std::uint64_t v = 0; v <= h.verticesNum; v += BUF_SIZE)
+    {
+        buf.clear();
+        for(std::uint64_t u = v; u <= h.verticesNum && u < v + BUF_SIZE; ++u)
+            buf.push_back(g.getAdjOffset(static_cast<std::uint32_t>(u)));
+        out.write(buf.data(), buf.size() * sizeof(std::uint64_t));
+    }
+
+    out.padTo(h.adjPos);
+    if(h.adjNum)
+        out.write(g.getAdjVertices(0).first, h.adjNum * sizeof(std::uint32_t));
+    if(labelSize)
+    {
+        out.padTo(h.labelsPos);
+        if(h.adjNum)
+            out.write(labels, h.adjNum * labelSize);
+    }
+    if(!identity)
+    {
+        out.padTo(h.verticesPos);
+        if(h.verticesNum)
+            out.write(&g.getVertex(0), h.verticesNum * sizeof(Vertex));
+    }
+    if(h.flags & HAS_VERTEX_INDEX)
+    {
+        out.padTo(getIndexPos(h));
+        out.write(g.getVertexIndex().data(), h.verticesNum * sizeof(std::uint32_t));
+    }
+    out.finish(h);
+}
+
+/// Makes a vertex from its dense id if there is no dictionary.
+template <typename Vertex>
+typename std::enable_if<std::is_integral<Vertex>::value, Vertex>::type
+makeVertex(std::uint32_t v)
+{
+    return static_cast<Vertex>(v);
+}
+
+template <typename Vertex>
+typename std::enable_if<!std::is_integral<Vertex>::value, Vertex>::type
+makeVertex(std::uint32_t)
+{
+    return Vertex();                        // never used: checked on opening
+}
+
+} // namespace bin_graph_details
+
+
+/// \brief Saves the CSR graph \a g to the binary file \a fn to be opened by
+/// BinUGraphView. Throws std::invalid_argument if the file can't be written.
+template <typename Vertex>
+void saveBinGraph(const std::string& fn, const CsrUGraph<Vertex>& g)
+{
+    bin_graph_details::save(fn, g, nullptr, 0);
+}
+
+/// Saves the CSR graph \a g with its edge labels to the binary file \a fn to
+/// be opened by BinEdgeLblUGraphView or BinUGraphView.
+template <typename Vertex, typename EdgeLbl>
+void saveBinGraph(const std::string& fn, const CsrEdgeLblUGraph<Vertex, EdgeLbl>& g)
+{
+    static_assert(std::is_trivially_copyable<EdgeLbl>::value,
+                  "Labels must be trivially copyable to be saved");
+    bin_graph_details::save(fn, g, g.getVerticesNum() ? g.getAdjLabels(0) : nullptr,
+                            static_cast<std::uint32_t>(sizeof(EdgeLbl)));
+}
+
+/// Saves the graph \a g to the binary file \a fn; see above.
+template <typename Vertex>
+void saveBinGraph(const std::string& fn, const UGraph<Vertex>& g)
+{
+    saveBinGraph(fn, CsrUGraph<Vertex>(g));
+}
+
+/// Saves the graph \a g to the binary file \a fn; edges that have no label
+/// in \a g are saved with \a dfltLbl.
+template <typename Vertex, typename EdgeLbl>
+void saveBinGraph(const std::string& fn, const EdgeLblUGraph<Vertex, EdgeLbl>& g,
+                  EdgeLbl dfltLbl = EdgeLbl())
+{
+    saveBinGraph(fn, CsrEdgeLblUGraph<Vertex, EdgeLbl>(g, dfltLbl));
+}
+
+
+/*! ****************************************************************************
+ *  \brief The BinUGraphView class is a read-only graph right in a mapped
+ *  binary file made by saveBinGraph().
+ *
+ *  Opening a file maps it, checks the header and the layout and makes a
+ *  pass over the offsets of the adjacency lists, 8 bytes per vertex; nothing
+ *  else is read or copied until the graph is used, and the pages are shared
+ *  among the processes mapping the same file. The checksum of the whole
+ *  content is checked by verify() (or on opening, if asked), which reads the
+ *  whole file. Without it the adjacency lists and the vertex index are
+ *  trusted: a file corrupted there yields dense ids out of range.
+ *
+ *  Provides the same methods as CsrUGraph, so the algorithms of the library
+ *  run on the view directly. Copies of a view share the mapping.
+ *
+ *  \tparam Vertex represents a type for vertices; must be the type the graph
+ *  is saved with.
+ ******************************************************************************/
+template <typename Vertex>
+class BinUGraphView {
+public:
+    // type definitions
+    typedef std::uint32_t VId;
+    typedef const VId* AdjIter;
+    typedef std::pair<AdjIter, AdjIter> AdjIterPair;
+
+public:
+    /// Creates an empty graph.
+    BinUGraphView()
+        : _verticesNum(0), _edgesNum(0), _offsets(&ZERO), _adj(nullptr),
+          _labels(nullptr), _vertices(nullptr), _index(nullptr)
+    {
+    }
+
+    /// \brief Opens the binary graph file \a fn; the checksum is checked if
+    /// \a verify.
+    ///
+    /// Throws std::invalid_argument if the file can't be read, is not a
+    /// binary graph of a known version with these types, or is broken.
+    explicit BinUGraphView(const std::string& fn, bool verify = false)
+        : BinUGraphView()
+    {
+        open(fn, verify, 0);
+    }
+
+public:
+    // setters/getters
+    size_t getVerticesNum() const { return static_cast<size_t>(_verticesNum); }
+    size_t getEdgesNum() const { return static_cast<size_t>(_edgesNum); }
+
+    size_t getDegree(VId v) const
+    {
+        return static_cast<size_t>(_offsets[v + 1] - _offsets[v]);
+    }
+
+    /// Collects the statistics of vertex degrees in a single pass.
+    DegreeStats getDegreeStats() const
+    {
+        DegreeStats st;
+        for(VId v = 0; v < getVerticesNum(); ++v)
+            st.addDegree(getDegree(v));
+        st.finish(getVerticesNum());
+
+        return st;
+    }
+
+    bool hasSelfLoop(VId v) const
+    {
+        AdjIterPair adj = getAdjVertices(v);
+        return std::binary_search(adj.first, adj.second, v);
+    }
+
+    size_t getAdjOffset(VId v) const { return static_cast<size_t>(_offsets[v]); }
+
+    /// Returns the original vertex by its dense id \a v.
+    Vertex getVertex(VId v) const
+    {
+        return _vertices ? _vertices[v] : bin_graph_details::makeVertex<Vertex>(v);
+    }
+
+    /// For a given vertex \a v tries to find its dense id, in O(log n).
+    bool getVId(const Vertex& v, VId& id) const
+    {
+        if(!_vertices)
+            return findDenseVId(v, id);
+
+        return csr_details::findVId(_vertices, static_cast<size_t>(_verticesNum), _index, v, id);
+    }
+
+    AdjIterPair getAdjVertices(VId v) const
+    {
+        return { _adj + _offsets[v], _adj + _offsets[v + 1] };
+    }
+
+    /// Returns true if the checksum of the content matches the header.
+    bool verify() const
+    {
+        if(!_file)
+            return true;
+
+        const bin_graph_details::Header& h = getHeader();
+        bin_graph_details::Checksum sum;
+        sum.update(_file->getData() + sizeof(h), _file->getSize() - sizeof(h));
+        return sum.get() == h.checksum;
+    }
+
+protected:
+    /// Maps the file checking it for labels of \a labelSize bytes (0 for no
+    /// labels needed).
+    void open(const std::string& fn, bool verify, std::uint32_t labelSize)
+    {
+        using namespace bin_graph_details;
+
+        std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>(fn);
+        if(file->getSize() < sizeof(Header))
+            throw std::invalid_argument("Not a binary graph file");
+
+        Header h;
+        std::memcpy(&h, file->getData(), sizeof(h));
+        if(h.magic != FILE_MAGIC)
+            throw std::invalid_argument(h.magic == swapBytes(FILE_MAGIC)
+                    ? "Binary graph file of another byte order"
+                    : "Not a binary graph file");
+        if(h.version < 1 || h.version > FILE_VERSION)
+            throw std::invalid_argument("Unsupported binary graph file version");
+
+        // the layout is fully defined by the counts
+        Header exp = h;
+        if(h.verticesNum >= (std::uint64_t(1) << 32) || h.adjNum >= (std::uint64_t(1) << 60)
+                || h.labelSize > (1u << 16) || h.vertexSize > (1u << 16))
+            throw std::invalid_argument("Broken binary graph file");
+        layOut(exp);
+        if(std::memcmp(&exp, &h, sizeof(h)) != 0 || h.fileSize != file->getSize()
+                || ((h.flags & HAS_LABELS) != 0) != (h.labelSize != 0)
+                || ((h.flags & HAS_VERTICES) != 0) != (h.vertexSize != 0)
+                || ((h.flags & HAS_VERTEX_INDEX)
+                    && (!(h.flags & HAS_VERTICES) || h.version < 2))
+                || (h.flags & ~(HAS_LABELS | HAS_VERTICES | HAS_VERTEX_INDEX)) != 0)
+            throw std::invalid_argument("Broken binary graph file");
+
+        if(labelSize && h.labelSize != labelSize)
+            throw std::invalid_argument("Binary graph file has no labels of this type");
+        if(h.vertexSize ? h.vertexSize != sizeof(Vertex) : !std::is_integral<Vertex>::value)
+            throw std::invalid_argument("Binary graph file has no vertices of this type");
+
+        const char* data = file->getData();
+        const std::uint64_t* offsets = reinterpret_cast<const std::uint64_t*>(data + h.offsetsPos);
+        if(offsets[0] != 0 || offsets[h.verticesNum] != h.adjNum)
+            throw std::invalid_argument("Broken binary graph file");
+        for(std::uint64_t v = 0; v < h.verticesNum; ++v)
+            if(offsets[v] > offsets[v + 1])
+                throw std::invalid_argument("Broken binary graph file");
+
+        _file = file;
+        _verticesNum = h.verticesNum;
+        _edgesNum = h.edgesNum;
+        _offsets = offsets;
+        _adj = reinterpret_cast<const VId*>(data + h.adjPos);
+        _labels = h.labelsPos ? data + h.labelsPos : nullptr;
+        _vertices = h.verticesPos ? reinterpret_cast<const Vertex*>(data + h.verticesPos)
+                                  : nullptr;
+        _index = (h.flags & HAS_VERTEX_INDEX)
+                ? reinterpret_cast<const VId*>(data + getIndexPos(h)) : nullptr;
+
+        if(verify && !this->verify())
+            throw std::invalid_argument("Binary graph file checksum mismatch");
+    }
+
+    const bin_graph_details::Header& getHeader() const
+    {
+        return *reinterpret_cast<const bin_graph_details::Header*>(_file->getData());
+    }
+
+    static std::uint32_t swapBytes(std::uint32_t x)
+    {
+        return (x >> 24) | ((x >> 8) & 0xff00) | ((x << 8) & 0xff0000) | (x << 24);
+    }
+
+    /// The dense id of \a v without a dictionary: \a v itself, if in range.
+    template <typename V = Vertex>
+    typename std::enable_if<std::is_integral<V>::value, bool>::type
+    findDenseVId(const V& v, VId& id) const
+    {
+        if(v < V() || static_cast<std::uint64_t>(v) >= _verticesNum)
+            return false;
+        id = static_cast<VId>(v);
+        return true;
+    }
+
+    template <typename V = Vertex>
+    typename std::enable_if<!std::is_integral<V>::value, bool>::type
+    findDenseVId(const V&, VId&) const
+    {
+        return false;
+    }
+
+protected:
+    static constexpr std::uint64_t ZERO = 0;   ///< Offsets of an empty graph.
+
+    std::shared_ptr<MappedFile> _file;
+    std::uint64_t _verticesNum;
+    std::uint64_t _edgesNum;
+    const std::uint64_t* _offsets;  ///< Beginnings of adjacency lists, n + 1.
+    const VId* _adj;                ///< Concatenated adjacency lists.
+    const char* _labels;            ///< Labels parallel to _adj, if any.
+    const Vertex* _vertices;        ///< Vertex dictionary, if any.
+    const VId* _index;              ///< Dense ids by vertices, if reordered.
+}; // class BinUGraphView
+
+template <typename Vertex>
+constexpr std::uint64_t BinUGraphView<Vertex>::ZERO;
+
+
+/*! ****************************************************************************
+ *  \brief The BinEdgeLblUGraphView class is a read-only labeled graph right in
+ *  a mapped binary file; the same as CsrEdgeLblUGraph for the algorithms.
+ *
+ *  \tparam EdgeLbl must be the type of labels the graph is saved with.
+ ******************************************************************************/
+template <typename Vertex, typename EdgeLbl>
+class BinEdgeLblUGraphView
+        : public BinUGraphView<Vertex>
+{
+public:
+    typedef BinUGraphView<Vertex> Base;
+    typedef typename Base::VId VId;
+    typedef EdgeLbl Label;
+    typedef const EdgeLbl* AdjLblIter;
+
+public:
+    /// Creates an empty graph.
+    BinEdgeLblUGraphView()
+    {
+    }
+
+    /// Opens the binary graph file \a fn, which must have labels of the type
+    /// EdgeLbl; see BinUGraphView.
+    explicit BinEdgeLblUGraphView(const std::string& fn, bool verify = false)
+    {
+        Base::open(fn, verify, sizeof(EdgeLbl));
+    }
+
+public:
+    /// Returns the labels of the edges adjacent to the vertex \a v, ordered
+    /// the same way as getAdjVertices(v).
+    AdjLblIter getAdjLabels(VId v) const
+    {
+        return reinterpret_cast<const EdgeLbl*>(Base::_labels) + Base::getAdjOffset(v);
+    }
+}; // class BinEdgeLblUGraphView
+
+
+#endif // GRIO_BIN_GRAPH_HPP
@@ -0,0 +1,269 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains a parallel loader of graphs from edge-list text files.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRIO_EDGELIST_READER_HPP
+#define GRIO_EDGELIST_READER_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "mmap_file.hpp"
+#include "parse_utils.hpp"
+#include "../ugraph/lbl_ugraph.hpp"
+#include "../ugraph/par_utils.hpp"
+
+
+namespace edgelist_details {
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, bool>::type
+parseValue(const char* b, const char* e, T& v)
+{
+    return parse::parseInteger(b, e, v);
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+parseValue(const char* b, const char* e, T& v)
+{
+    return parse::parseFloat(b, e, v);
+}
+
+inline bool parseValue(const char* b, const char* e, std::string& v)
+{
+    v.assign(b, e);
+    return true;
+}
+
+inline bool isBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+}
+
+/// Throws an error for the line starting at \a at of a text in the \a format.
+[[noreturn]] inline void fail(const char* data, const char* at, const char* what,
+                              const char* format = "Edge list")
+{
+    size_t line = 1;
+    for(const char* p = data; p < at; ++p)
+        if(*p == '\n')
+            ++line;
+
+    throw std::invalid_argument(std::string(format) + ": line " + std::to_string(line)
+                                + ": " + what);
+}
+
+/// Edges of one part of a file.
+template <typename Vertex, typename EdgeLbl>
+struct ChunkEdges {
+    std::vector<std::pair<Vertex, Vertex>> edges;
+    std::vector<std::pair<std::pair<Vertex, Vertex>, EdgeLbl>> lblEdges;
+};
+
+/// \brief Parses the lines in [b, e) of the text starting at \a data into
+/// \a out. Lines with a third field go to out.lblEdges if \a withLabels.
+template <typename Vertex, typename EdgeLbl>
+void parseChunk(const char* data, const char* b, const char* e, bool withLabels,
+                ChunkEdges<Vertex, EdgeLbl>& out)
+{
+    const char* fields[3][2];
+    while(b < e)
+    {
+        const char* eol = static_cast<const char*>(
+            std::memchr(b, '\n', static_cast<size_t>(e - b)));
+        if(!eol)
+            eol = e;
+
+        // splits the line into (at most) three fields
+        size_t n = 0;
+        for(const char* p = b; p < eol && n < 3; )
+        {
+            while(p < eol && isBlank(*p))
+                ++p;
+            if(p == eol || (n == 0 && (*p == '#' || *p == '%')))
+                break;                                  // a comment
+            fields[n][0] = p;
+            while(p < eol && !isBlank(*p))
+                ++p;
+            fields[n++][1] = p;
+        }
+
+        if(n == 1)
+            fail(data, b, "two vertices expected");
+        if(n >= 2)
+        {
+            std::pair<Vertex, Vertex> edge;
+            if(!parseValue(fields[0][0], fields[0][1], edge.first)
+               || !parseValue(fields[1][0], fields[1][1], edge.second))
+                fail(data, b, "bad vertex");
+
+            if(n == 3 && withLabels)
+            {
+                EdgeLbl lbl;
+                if(!parseValue(fields[2][0], fields[2][1], lbl))
+                    fail(data, b, "bad label");
+                out.lblEdges.push_back({edge, lbl});
+            }
+            else
+                out.edges.push_back(edge);
+        }
+
+        b = eol + 1;
+    }
+}
+
+/// \brief Splits the text of \a size bytes at \a data into parts to be
+/// parsed on \a threadsNum threads; returns the bounds of the parts.
+///
+/// The parts are of about the same size and split after newlines; there are
+/// more parts than threads to balance them.
+inline std::vector<const char*> splitText(const char* data, size_t size, unsigned threadsNum)
+{
+    const size_t MIN_CHUNK = 1 << 20;
+    size_t chunksNum = std::max<size_t>(1, std::min<size_t>(threadsNum * 4, size / MIN_CHUNK));
+
+    std::vector<const char*> bounds(chunksNum + 1, data + size);
+    bounds[0] = data;
+    for(size_t i = 1; i < chunksNum; ++i)
+    {
+        const char* p = std::max(bounds[i - 1], data + size / chunksNum * i);
+        const void* nl = std::memchr(p, '\n', static_cast<size_t>(data + size - p));
+        bounds[i] = nl ? static_cast<const char*>(nl) + 1 : data + size;
+    }
+
+    return bounds;
+}
+
+/// \brief Parses the text of \a size bytes at \a data on \a threadsNum
+/// threads and returns the edges of the parts of the file in order.
+template <typename Vertex, typename EdgeLbl>
+std::vector<ChunkEdges<Vertex, EdgeLbl>> parseText(const char* data, size_t size,
+                                                   unsigned threadsNum, bool withLabels)
+{
+    threadsNum = par::getThreadsNum(threadsNum);
+    std::vector<const char*> bounds = splitText(data, size, threadsNum);
+
+    std::vector<ChunkEdges<Vertex, EdgeLbl>> chunks(bounds.size() - 1);
+    par::parallelFor(chunks.size(), threadsNum, [&](size_t i, unsigned)
+    {
+        parseChunk(data, bounds[i], bounds[i + 1], withLabels, chunks[i]);
+    }, 1);
+
+    return chunks;
+}
+
+} // namespace edgelist_details
+
+
+/*! ****************************************************************************
+ *  \brief Loads edges from the edge-list text of \a size bytes at \a data
+ *  into \a g on \a threadsNum threads (0 means all hardware threads).
+ *
+ *  Every line is "src dst" separated by spaces or tabs; further fields are
+ *  ignored (e.g. weights or timestamps). Empty lines and lines starting with
+ *  '#' or '%' (SNAP and Matrix Market comments) are skipped. Line endings
+ *  may be "\n" or "\r\n".
+ *
+ *  The text is split at newlines into parts parsed concurrently with
+ *  locale-independent number parsers into separate edge buffers, which are
+ *  then added to \a g at once by UGraph::addEdges() (a single sort and
+ *  deduplication). A malformed line is reported by std::invalid_argument
+ *  with its number; nothing is added to \a g then.
+ ******************************************************************************/
+template <typename Vertex>
+void readEdgeList(const char* data, size_t size, UGraph<Vertex>& g,
+                  unsigned threadsNum = 0)
+{
+    typedef edgelist_details::ChunkEdges<Vertex, char> Chunk;
+    std::vector<Chunk> chunks = edgelist_details::parseText<Vertex, char>(
+                data, size, threadsNum, false);
+
+    size_t total = 0;
+    for(const Chunk& ch : chunks)
+        total += ch.edges.size();
+
+    std::vector<typename UGraph<Vertex>::Edge> edges;
+    edges.reserve(total);
+    for(Chunk& ch : chunks)
+    {
+        edges.insert(edges.end(), ch.edges.begin(), ch.edges.end());
+        std::vector<typename UGraph<Vertex>::Edge>().swap(ch.edges);
+    }
+    g.addEdges(std::move(edges));
+}
+
+/// Loads edges from the edge-list file \a fn into \a g; see above.
+template <typename Vertex>
+void readEdgeList(const std::string& fn, UGraph<Vertex>& g, unsigned threadsNum = 0)
+{
+    MappedFile file(fn);
+    readEdgeList(file.getData(), file.getSize(), g, threadsNum);
+}
+
+/*! ****************************************************************************
+ *  \brief Loads edges from the edge-list text of \a size bytes at \a data
+ *  into the labeled graph \a g on \a threadsNum threads.
+ *
+ *  The same as readEdgeList(), except that the third field of a line, if
+ *  any, is the label of the edge ("src dst weight"); lines of two fields make
+ *  unlabeled edges. An edge repeated in the text gets its first label.
+ ******************************************************************************/
+template <typename Vertex, typename EdgeLbl>
+void readLblEdgeList(const char* data, size_t size, EdgeLblUGraph<Vertex, EdgeLbl>& g,
+                     unsigned threadsNum = 0)
+{
+    typedef edgelist_details::ChunkEdges<Vertex, EdgeLbl> Chunk;
+    typedef EdgeLblUGraph<Vertex, EdgeLbl> Graph;
+    std::vector<Chunk> chunks = edgelist_details::parseText<Vertex, EdgeLbl>(
+                data, size, threadsNum, true);
+
+    size_t total = 0, lblTotal = 0;
+    for(const Chunk& ch : chunks)
+    {
+        total += ch.edges.size();
+        lblTotal += ch.lblEdges.size();
+    }
+
+    std::vector<typename Graph::Edge> edges;
+    std::vector<typename Graph::LblEdge> lblEdges;
+    edges.reserve(total);
+    lblEdges.reserve(lblTotal);
+    for(Chunk& ch : chunks)
+    {
+        edges.insert(edges.end(), ch.edges.begin(), ch.edges.end());
+        lblEdges.insert(lblEdges.end(), std::make_move_iterator(ch.lblEdges.begin()),
+                        std::make_move_iterator(ch.lblEdges.end()));
+        ch = Chunk();
+    }
+    g.addEdges(std::move(edges));
+    g.addLblEdges(std::move(lblEdges));
+}
+
+/// Loads edges from the edge-list file \a fn into \a g; see above.
+template <typename Vertex, typename EdgeLbl>
+void readLblEdgeList(const std::string& fn, EdgeLblUGraph<Vertex, EdgeLbl>& g,
+                     unsigned threadsNum = 0)
+{
+    MappedFile file(fn);
+    readLblEdgeList(file.getData(), file.getSize(), g, threadsNum);
+}
+
+
+#endif // GRIO_EDGELIST_READER_HPP
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains a read-only memory-mapped file.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRIO_MMAP_FILE_HPP
+#define GRIO_MMAP_FILE_HPP
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define GRIO_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+/*! ****************************************************************************
+ *  \brief The MappedFile class gives read-only access to the whole content of
+ *  a file.
+ *
+ *  On POSIX systems the file is mapped to memory with mmap(), so the pages
+ *  are loaded on demand and shared among all the processes mapping the same
+ *  file. On other systems (or if mapping fails) the file is read into a
+ *  buffer. In both cases the data is aligned at least as malloc() does.
+ ******************************************************************************/
+class MappedFile {
+public:
+    /// Maps the file \a fn; throws std::invalid_argument if it can't be read.
+    explicit MappedFile(const std::string& fn)
+        : _data(nullptr), _size(0), _mapped(false)
+    {
+#ifdef GRIO_HAS_MMAP
+        int fd = ::open(fn.c_str(), O_RDONLY);
+        if(fd < 0)
+            throw std::invalid_argument("Can't open file for mapping");
+
+        struct stat st;
+        bool empty = false;
+        if(::fstat(fd, &st) == 0 && !(empty = (st.st_size == 0)))
+        {
+            void* p = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ,
+                             MAP_SHARED, fd, 0);
+            if(p != MAP_FAILED)
+            {
+                _data = static_cast<const char*>(p);
+                _size = static_cast<size_t>(st.st_size);
+                _mapped = true;
+            }
+        }
+        ::close(fd);
+        if(_mapped || empty)
+            return;
+#endif
+        readAll(fn);
+    }
+
+    ~MappedFile()
+    {
+#ifdef GRIO_HAS_MMAP
+        if(_mapped)
+            ::munmap(const_cast<char*>(_data), _size);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+public:
+    /// Returns the content of the file; nullptr for an empty one.
+    const char* getData() const { return _data; }
+
+    size_t getSize() const { return _size; }
+
+    /// Returns true if the file is mapped, false if it has been read.
+    bool isMapped() const { return _mapped; }
+
+protected:
+    void readAll(const std::string& fn)
+    {
+        std::ifstream in(fn, std::ios::binary | std::ios::ate);
+        if(!in)
+            throw std::invalid_argument("Can't open file for mapping");
+
+        _buffer.resize(static_cast<size_t>(in.tellg()));
+        in.seekg(0);
+        in.read(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+        if(!in)
+            throw std::invalid_argument("Can't read file");
+
+        _data = _buffer.empty() ? nullptr : _buffer.data();
+        _size = _buffer.size();
+    }
+
+protected:
+    const char* _data;
+    size_t _size;
+    bool _mapped;
+    std::vector<char> _buffer;      ///< Content of a file that is not mapped.
+}; // class MappedFile
+
+
+#endif // GRIO_MMAP_FILE_HPP
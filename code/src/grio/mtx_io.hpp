@@ -0,0 +1,467 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains a reader and a writer of graphs in the Matrix Market
+///             coordinate format.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+/// A symmetric sparse matrix of N rows is a graph of the vertices 0..N-1
+/// with an edge {i-1, j-1} for every entry (i, j), labeled by its value. See
+/// https://math.nist.gov/MatrixMarket/formats.html.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRIO_MTX_IO_HPP
+#define GRIO_MTX_IO_HPP
+
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "edgelist_reader.hpp"
+#include "../grviz/gen_dot_writer.hpp"
+
+
+namespace mtx_details {
+
+static const char* const FORMAT = "Matrix Market";
+
+typedef xi::ldopa::graph::DotOutBuffer OutBuffer;
+
+/// Types of matrix entries.
+enum class Field {
+    REAL,
+    INTEGER,
+    PATTERN                 ///< No values.
+};
+
+/// The banner and the size line of a file.
+struct Header {
+    Field field;
+    std::uint64_t rows;
+    std::uint64_t entries;
+    const char* body;       ///< Beginning of the entries.
+};
+
+inline const char* findEol(const char* b, const char* e)
+{
+    const void* eol = std::memchr(b, '\n', static_cast<size_t>(e - b));
+    return eol ? static_cast<const char*>(eol) : e;
+}
+
+/// \brief Splits the line [b, e) into fields separated by blanks, stores
+/// the bounds of at most \a maxFields of them and returns the number of all.
+inline size_t splitLine(const char* b, const char* e, const char* fields[][2],
+                        size_t maxFields)
+{
+    size_t n = 0;
+    while(true)
+    {
+        while(b < e && edgelist_details::isBlank(*b))
+            ++b;
+        if(b == e)
+            return n;
+        const char* beg = b;
+        while(b < e && !edgelist_details::isBlank(*b))
+            ++b;
+        if(n < maxFields)
+        {
+            fields[n][0] = beg;
+            fields[n][1] = b;
+        }
+        ++n;
+    }
+}
+
+/// Compares [b, e) with the lower-case string \a s ignoring the case.
+inline bool equalsNoCase(const char* b, const char* e, const char* s)
+{
+    for(; b < e && *s; ++b, ++s)
+        if(std::tolower(static_cast<unsigned char>(*b)) != *s)
+            return false;
+
+    return b == e && !*s;
+}
+
+/// Parses the banner and the size line of the text of \a size bytes at \a data.
+inline Header parseHeader(const char* data, size_t size)
+{
+    const char* end = data + size;
+    const char* fields[5][2];
+
+    const char* b = data;
+    const char* eol = findEol(b, end);
+    if(splitLine(b, eol, fields, 5) != 5
+       || !equalsNoCase(fields[0][0], fields[0][1], "%%matrixmarket"))
+        edgelist_details::fail(data, b, "\"%%MatrixMarket matrix coordinate ...\" expected",
+                               FORMAT);
+    if(!equalsNoCase(fields[1][0], fields[1][1], "matrix"))
+        edgelist_details::fail(data, b, "a matrix expected", FORMAT);
+    if(!equalsNoCase(fields[2][0], fields[2][1], "coordinate"))
+        edgelist_details::fail(data, b, "only the coordinate format is supported", FORMAT);
+
+    Header h;
+    if(equalsNoCase(fields[3][0], fields[3][1], "real")
+       || equalsNoCase(fields[3][0], fields[3][1], "double"))
+        h.field = Field::REAL;
+    else if(equalsNoCase(fields[3][0], fields[3][1], "integer"))
+        h.field = Field::INTEGER;
+    else if(equalsNoCase(fields[3][0], fields[3][1], "pattern"))
+        h.field = Field::PATTERN;
+    else
+        edgelist_details::fail(data, b, "only real, integer and pattern matrices are supported",
+                               FORMAT);
+
+    // a general matrix is read as a symmetric one: (i, j) and (j, i) make
+    // the same edge; skew-symmetric and hermitian ones have no such meaning
+    if(!equalsNoCase(fields[4][0], fields[4][1], "symmetric")
+       && !equalsNoCase(fields[4][0], fields[4][1], "general"))
+        edgelist_details::fail(data, b, "only symmetric and general matrices are supported",
+                               FORMAT);
+
+    // comments and the size line
+    size_t n = 0;
+    while(eol < end && n == 0)
+    {
+        b = eol + 1;
+        eol = findEol(b, end);
+        n = splitLine(b, eol, fields, 3);
+        if(n && *fields[0][0] == '%')
+            n = 0;
+    }
+
+    std::uint64_t cols;
+    if(n != 3 || !parse::parseInteger(fields[0][0], fields[0][1], h.rows)
+       || !parse::parseInteger(fields[1][0], fields[1][1], cols)
+       || !parse::parseInteger(fields[2][0], fields[2][1], h.entries))
+        edgelist_details::fail(data, b, "\"rows columns entries\" expected", FORMAT);
+    if(h.rows != cols)
+        edgelist_details::fail(data, b, "a square matrix expected", FORMAT);
+
+    h.body = eol < end ? eol + 1 : end;
+
+    return h;
+}
+
+/// \brief Parses the entries in [b, e) of the text starting at \a data into
+/// \a out. The values go to out.lblEdges if \a withLabels.
+template <typename Vertex, typename EdgeLbl>
+void parseChunk(const char* data, const char* b, const char* e, const Header& h,
+                bool withLabels, edgelist_details::ChunkEdges<Vertex, EdgeLbl>& out)
+{
+    const size_t fieldsNum = h.field == Field::PATTERN ? 2 : 3;
+    const char* fields[3][2];
+    while(b < e)
+    {
+        const char* eol = findEol(b, e);
+        size_t n = splitLine(b, eol, fields, 3);
+        if(n && *fields[0][0] != '%')
+        {
+            if(n != fieldsNum)
+                edgelist_details::fail(data, b, fieldsNum == 2 ? "\"row column\" expected"
+                                                               : "\"row column value\" expected",
+                                       FORMAT);
+
+            std::uint64_t i, j;
+            if(!parse::parseInteger(fields[0][0], fields[0][1], i)
+               || !parse::parseInteger(fields[1][0], fields[1][1], j)
+               || i == 0 || j == 0 || i > h.rows || j > h.rows)
+                edgelist_details::fail(data, b, "bad index", FORMAT);
+
+            std::pair<Vertex, Vertex> edge(static_cast<Vertex>(i - 1),
+                                           static_cast<Vertex>(j - 1));
+            if(withLabels)
+            {
+                EdgeLbl lbl;
+                if(!edgelist_details::parseValue(fields[2][0], fields[2][1], lbl))
+                    edgelist_details::fail(data, b, "bad value", FORMAT);
+                out.lblEdges.push_back({edge, lbl});
+            }
+            else
+                out.edges.push_back(edge);
+        }
+
+        b = eol + 1;
+    }
+}
+
+/// \brief Parses the text of \a size bytes at \a data on \a threadsNum
+/// threads; returns the edges of the parts of the file in order and the
+/// header in \a h.
+template <typename Vertex, typename EdgeLbl>
+std::vector<edgelist_details::ChunkEdges<Vertex, EdgeLbl>>
+parseText(const char* data, size_t size, unsigned threadsNum, bool withLabels, Header& h)
+{
+    static_assert(std::is_integral<Vertex>::value, "Vertices must be integral");
+
+    h = parseHeader(data, size);
+    if(h.rows && h.rows - 1 > static_cast<std::uint64_t>(std::numeric_limits<Vertex>::max()))
+        throw std::invalid_argument("Matrix Market: too many rows for the vertex type");
+    withLabels = withLabels && h.field != Field::PATTERN;
+
+    threadsNum = par::getThreadsNum(threadsNum);
+    std::vector<const char*> bounds = edgelist_details::splitText(
+                h.body, static_cast<size_t>(data + size - h.body), threadsNum);
+
+    std::vector<edgelist_details::ChunkEdges<Vertex, EdgeLbl>> chunks(bounds.size() - 1);
+    par::parallelFor(chunks.size(), threadsNum, [&](size_t i, unsigned)
+    {
+        parseChunk(data, bounds[i], bounds[i + 1], h, withLabels, chunks[i]);
+    }, 1);
+
+    std::uint64_t entries = 0;
+    for(const edgelist_details::ChunkEdges<Vertex, EdgeLbl>& ch : chunks)
+        entries += ch.edges.size() + ch.lblEdges.size();
+    if(entries != h.entries)
+        throw std::invalid_argument("Matrix Market: " + std::to_string(h.entries)
+                                    + " entries expected, " + std::to_string(entries)
+                                    + " found");
+
+    return chunks;
+}
+
+/// Moves the \a member vectors of all \a chunks into one.
+template <typename Chunk, typename T>
+std::vector<T> joinChunks(std::vector<Chunk>& chunks, std::vector<T> Chunk::*member)
+{
+    size_t total = 0;
+    for(const Chunk& ch : chunks)
+        total += (ch.*member).size();
+
+    std::vector<T> res;
+    res.reserve(total);
+    for(Chunk& ch : chunks)
+    {
+        res.insert(res.end(), std::make_move_iterator((ch.*member).begin()),
+                   std::make_move_iterator((ch.*member).end()));
+        std::vector<T>().swap(ch.*member);
+    }
+
+    return res;
+}
+
+template <typename Vertex>
+std::vector<Vertex> makeVertices(std::uint64_t n)
+{
+    std::vector<Vertex> vs;
+    vs.reserve(static_cast<size_t>(n));
+    for(std::uint64_t i = 0; i < n; ++i)
+        vs.push_back(static_cast<Vertex>(i));
+
+    return vs;
+}
+
+/// Returns the number of rows of the matrix of \a g: the largest vertex + 1.
+template <typename Vertex>
+std::uint64_t getRowsNum(const UGraph<Vertex>& g)
+{
+    static_assert(std::is_integral<Vertex>::value, "Vertices must be integral");
+
+    typename UGraph<Vertex>::VertexIterPair vs = g.getVertices();
+    if(vs.first == vs.second)
+        return 0;
+    if(*vs.first < Vertex())
+        throw std::invalid_argument("Matrix Market: vertices must be non-negative");
+
+    return static_cast<std::uint64_t>(*std::prev(vs.second)) + 1;
+}
+
+/// Outputs the banner and the size line.
+inline void putHeader(OutBuffer& buf, const char* field, std::uint64_t rows,
+                      std::uint64_t entries)
+{
+    buf.put("%%MatrixMarket matrix coordinate ");
+    buf.put(field);
+    buf.put(" symmetric\n");
+    buf.putValue(rows);
+    buf.put(' ');
+    buf.putValue(rows);
+    buf.put(' ');
+    buf.putValue(entries);
+    buf.put('\n');
+}
+
+/// Outputs the indices of the normalized edge {\a s, \a d}: the lower triangle.
+template <typename Vertex>
+void putIndices(OutBuffer& buf, const Vertex& s, const Vertex& d)
+{
+    buf.putValue(static_cast<std::uint64_t>(d) + 1);
+    buf.put(' ');
+    buf.putValue(static_cast<std::uint64_t>(s) + 1);
+}
+
+/// Opens the file \a fn for writing, writes to it by \a write(out) and
+/// checks the result.
+template <typename F>
+void writeFile(const std::string& fn, F write)
+{
+    std::ofstream out(fn, std::ios::binary);
+    if(!out)
+        throw std::invalid_argument("Can't open file for a Matrix Market matrix");
+    write(out);
+    out.flush();
+    if(!out)
+        throw std::invalid_argument("Can't write a Matrix Market matrix");
+}
+
+} // namespace mtx_details
+
+
+/*! ****************************************************************************
+ *  \brief Loads a Matrix Market matrix from the text of \a size bytes at
+ *  \a data into \a g on \a threadsNum threads (0 means all hardware threads).
+ *
+ *  The matrix must be square and given by coordinates; its N rows become the
+ *  vertices 0..N-1 (all of them, with or without edges), and an entry (i, j)
+ *  becomes the edge {i-1, j-1}, a self-loop for a diagonal entry. Values, if
+ *  any, are ignored. A "general" matrix is read as a symmetric one, so
+ *  entries (i, j) and (j, i) make the same edge.
+ *
+ *  Entries are parsed concurrently, as readEdgeList() does, and added to
+ *  \a g at once. A malformed line, an index out of range or a wrong number
+ *  of entries are reported by std::invalid_argument; nothing is added to
+ *  \a g then.
+ ******************************************************************************/
+template <typename Vertex>
+void readMtx(const char* data, size_t size, UGraph<Vertex>& g, unsigned threadsNum = 0)
+{
+    typedef edgelist_details::ChunkEdges<Vertex, char> Chunk;
+    mtx_details::Header h;
+    std::vector<Chunk> chunks = mtx_details::parseText<Vertex, char>(
+                data, size, threadsNum, false, h);
+
+    g.addVertices(mtx_details::makeVertices<Vertex>(h.rows));
+    g.addEdges(mtx_details::joinChunks(chunks, &Chunk::edges));
+}
+
+/// Loads a Matrix Market matrix from the file \a fn into \a g; see above.
+template <typename Vertex>
+void readMtx(const std::string& fn, UGraph<Vertex>& g, unsigned threadsNum = 0)
+{
+    MappedFile file(fn);
+    readMtx(file.getData(), file.getSize(), g, threadsNum);
+}
+
+/*! ****************************************************************************
+ *  \brief Loads a Matrix Market matrix from the text of \a size bytes at
+ *  \a data into the labeled graph \a g on \a threadsNum threads.
+ *
+ *  The same as readMtx(), except that the values of a real or integer
+ *  matrix become the labels of edges; an edge given twice gets its first
+ *  value. The edges of a pattern matrix are unlabeled.
+ ******************************************************************************/
+template <typename Vertex, typename EdgeLbl>
+void readLblMtx(const char* data, size_t size, EdgeLblUGraph<Vertex, EdgeLbl>& g,
+                unsigned threadsNum = 0)
+{
+    typedef edgelist_details::ChunkEdges<Vertex, EdgeLbl> Chunk;
+    mtx_details::Header h;
+    std::vector<Chunk> chunks = mtx_details::parseText<Vertex, EdgeLbl>(
+                data, size, threadsNum, true, h);
+
+    g.addVertices(mtx_details::makeVertices<Vertex>(h.rows));
+    g.addEdges(mtx_details::joinChunks(chunks, &Chunk::edges));
+    g.addLblEdges(mtx_details::joinChunks(chunks, &Chunk::lblEdges));
+}
+
+/// Loads a Matrix Market matrix from the file \a fn into \a g; see above.
+template <typename Vertex, typename EdgeLbl>
+void readLblMtx(const std::string& fn, EdgeLblUGraph<Vertex, EdgeLbl>& g,
+                unsigned threadsNum = 0)
+{
+    MappedFile file(fn);
+    readLblMtx(file.getData(), file.getSize(), g, threadsNum);
+}
+
+/*! ****************************************************************************
+ *  \brief Writes \a g to \a out as a symmetric pattern matrix.
+ *
+ *  Vertices must be non-negative integers; the matrix has a row for each
+ *  of 0..the largest vertex, so readMtx() adds the missing ones. Every edge
+ *  is written once, in the lower triangle, right from the iteration over
+ *  edges into a buffer flushed to \a out by large blocks.
+ ******************************************************************************/
+template <typename Vertex>
+void writeMtx(std::ostream& out, const UGraph<Vertex>& g)
+{
+    mtx_details::OutBuffer buf(1 << 16);
+    buf.attach(out);
+    mtx_details::putHeader(buf, "pattern", mtx_details::getRowsNum(g), g.getEdgesNum());
+
+    typename UGraph<Vertex>::EdgeIterPair es = g.getEdges();
+    for(typename UGraph<Vertex>::EdgeIter it = es.first; it != es.second; ++it)
+    {
+        mtx_details::putIndices(buf, it->first, it->second);
+        buf.put('\n');
+    }
+    buf.detach();
+}
+
+/// Writes \a g to the file \a fn; see above. Throws std::invalid_argument
+/// if the file can't be written.
+template <typename Vertex>
+void writeMtx(const std::string& fn, const UGraph<Vertex>& g)
+{
+    mtx_details::writeFile(fn, [&g](std::ostream& out) { writeMtx(out, g); });
+}
+
+/*! ****************************************************************************
+ *  \brief Writes the labeled graph \a g to \a out as a symmetric integer
+ *  or real matrix, depending on the type of labels.
+ *
+ *  The same as writeMtx(); the value of an entry is the label of its edge,
+ *  or \a dfltLbl for an unlabeled one. Real values are written with all
+ *  the digits needed to read them back exactly; character labels are
+ *  written as numbers.
+ ******************************************************************************/
+template <typename Vertex, typename EdgeLbl>
+void writeLblMtx(std::ostream& out, const EdgeLblUGraph<Vertex, EdgeLbl>& g,
+                 const EdgeLbl& dfltLbl = EdgeLbl())
+{
+    static_assert(std::is_arithmetic<EdgeLbl>::value, "Labels must be numbers");
+    typedef EdgeLblUGraph<Vertex, EdgeLbl> Graph;
+
+    mtx_details::OutBuffer buf(1 << 16);
+    buf.setPrecision(std::numeric_limits<EdgeLbl>::max_digits10);
+    buf.attach(out);
+    mtx_details::putHeader(buf, std::is_integral<EdgeLbl>::value ? "integer" : "real",
+                           mtx_details::getRowsNum(g), g.getEdgesNum());
+
+    typename Graph::EdgeIterPair es = g.getEdges();
+    for(typename Graph::EdgeIter it = es.first; it != es.second; ++it)
+    {
+        EdgeLbl lbl = dfltLbl;
+        g.getLabel(it->first, it->second, lbl);
+        mtx_details::putIndices(buf, it->first, it->second);
+        buf.put(' ');
+        buf.putValue(+lbl);             // character types promoted to numbers
+        buf.put('\n');
+    }
+    buf.detach();
+}
+
+/// Writes \a g to the file \a fn; see above. Throws std::invalid_argument
+/// if the file can't be written.
+template <typename Vertex, typename EdgeLbl>
+void writeLblMtx(const std::string& fn, const EdgeLblUGraph<Vertex, EdgeLbl>& g,
+                 const EdgeLbl& dfltLbl = EdgeLbl())
+{
+    mtx_details::writeFile(fn, [&](std::ostream& out) { writeLblMtx(out, g, dfltLbl); });
+}
+
+
+#endif // GRIO_MTX_IO_HPP
@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains fast locale-independent parsers of numbers.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRIO_PARSE_UTILS_HPP
+#define GRIO_PARSE_UTILS_HPP
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+
+namespace parse {
+
+/// Parses an integer making up the whole range [b, e), with an optional sign.
+/// Returns false if it is malformed or out of the range of \a T.
+template <typename T>
+bool parseInteger(const char* b, const char* e, T& v)
+{
+    static_assert(std::is_integral<T>::value, "An integral type expected");
+    typedef typename std::make_unsigned<T>::type U;
+
+    bool neg = b < e && *b == '-';
+    if(neg && !std::is_signed<T>::value)
+        return false;
+    if(b < e && (*b == '-' || *b == '+'))
+        ++b;
+    if(b == e)
+        return false;
+
+    U limit = neg ? U(U(0) - U(std::numeric_limits<T>::min()))
+                  : U(std::numeric_limits<T>::max());
+    U u = 0;
+    for(; b < e; ++b)
+    {
+        unsigned d = static_cast<unsigned>(*b - '0');
+        if(d > 9 || u > (limit - d) / 10)
+            return false;
+        u = static_cast<U>(u * 10 + d);
+    }
+    v = static_cast<T>(neg ? U(U(0) - u) : u);
+    return true;
+}
+
+/// Parses [b, e) by strtold(); the fallback of parseFloat().
+template <typename T>
+bool parseFloatSlow(const char* b, const char* e, T& v)
+{
+    char buf[64];
+    std::string str;
+    size_t n = static_cast<size_t>(e - b);
+    const char* s = buf;
+    if(n < sizeof(buf))
+    {
+        std::memcpy(buf, b, n);
+        buf[n] = '\0';
+    }
+    else
+        s = (str.assign(b, e)).c_str();
+
+    if(n == 0 || *s == ' ' || *s == '\t' || *s == '\n')  // no leading spaces
+        return false;
+
+    char* end;
+    long double d = std::strtold(s, &end);
+    if(end != s + n)
+        return false;
+    v = static_cast<T>(d);
+    return true;
+}
+
+/// \brief Parses a floating-point number making up the whole range [b, e).
+///
+/// Decimal numbers of up to 15 significant digits and exponents within
+/// ±22, i.e. nearly all numbers written by programs, are converted exactly
+/// (a single rounding) without the C library; the rest, including "inf" and
+/// "nan", go to strtod(), which is then affected by the C locale.
+template <typename T>
+bool parseFloat(const char* b, const char* e, T& v)
+{
+    static_assert(std::is_floating_point<T>::value, "A floating-point type expected");
+    static const double POWERS[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    const char* p = b;
+    bool neg = p < e && *p == '-';
+    if(p < e && (*p == '-' || *p == '+'))
+        ++p;
+
+    std::uint64_t m = 0;
+    int digits = 0, exp10 = 0;
+    bool any = false;
+    for(; p < e && unsigned(*p - '0') <= 9; ++p, any = true)
+    {
+        if(digits < 19)
+        {
+            m = m * 10 + unsigned(*p - '0');
+            digits += m != 0;
+        }
+        else
+            ++exp10;
+    }
+    if(p < e && *p == '.')
+    {
+        for(++p; p < e && unsigned(*p - '0') <= 9; ++p, any = true)
+        {
+            if(digits < 19)
+            {
+                m = m * 10 + unsigned(*p - '0');
+                digits += m != 0;
+                --exp10;
+            }
+        }
+    }
+    if(any && p < e && (*p == 'e' || *p == 'E'))
+    {
+        int x;
+        if(!parseInteger(p + 1, e, x) || x > 10000 || x < -10000)
+            return parseFloatSlow(b, e, v);
+        exp10 += x;
+        p = e;
+    }
+
+    if(!any || p != e || digits > 15 || exp10 > 22 || exp10 < -22)
+        return parseFloatSlow(b, e, v);
+
+    double d = static_cast<double>(m);
+    d = exp10 < 0 ? d / POWERS[-exp10] : d * POWERS[exp10];
+    v = static_cast<T>(neg ? -d : d);
+    return true;
+}
+
+} // namespace parse
+
+
+#endif // GRIO_PARSE_UTILS_HPP
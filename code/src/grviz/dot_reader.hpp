@@ -0,0 +1,570 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      DOT-reader for labeled graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRVIZ_DOT_READER_HPP
+#define GRVIZ_DOT_READER_HPP
+
+#include <cctype>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../grio/mmap_file.hpp"
+#include "../grio/parse_utils.hpp"
+#include "../ugraph/lbl_ugraph.hpp"
+
+
+namespace dot_reader_details {
+
+enum class TokenType {
+    id,                 ///< Identifier or numeral.
+    quoted,             ///< Double-quoted string, without the quotes.
+    lbrace, rbrace, lbracket, rbracket, equal, semicolon, comma,
+    edgeOp,             ///< "--"
+    arrow,              ///< "->"
+    end
+};
+
+/// A token referring right to the input.
+struct Token {
+    TokenType type;
+    const char* beg;
+    const char* end;
+    bool escaped;       ///< A quoted string has backslashes.
+};
+
+/*! ****************************************************************************
+ *  \brief Splits a DOT text into tokens without copying them.
+ *
+ *  Skips whitespace and comments (C and C++ style, and lines starting with
+ *  '#'). Errors are reported by std::invalid_argument with the line number.
+ ******************************************************************************/
+class Lexer {
+public:
+    Lexer(const char* data, size_t size)
+        : _beg(data), _cur(data), _end(data + size), _hasPeeked(false)
+    {
+    }
+
+    Token next()
+    {
+        if(_hasPeeked)
+        {
+            _hasPeeked = false;
+            return _peeked;
+        }
+        return scan();
+    }
+
+    const Token& peek()
+    {
+        if(!_hasPeeked)
+        {
+            _peeked = scan();
+            _hasPeeked = true;
+        }
+        return _peeked;
+    }
+
+    /// Throws an error for the position \a at.
+    [[noreturn]] void fail(const char* at, const char* what) const
+    {
+        size_t line = 1;
+        for(const char* p = _beg; p < at && p < _end; ++p)
+            if(*p == '\n')
+                ++line;
+
+        throw std::invalid_argument("DOT: line " + std::to_string(line) + ": " + what);
+    }
+
+protected:
+    static bool isIdChar(char c)
+    {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '.'
+               || static_cast<unsigned char>(c) >= 0x80;
+    }
+
+    void skipSpaces()
+    {
+        while(_cur < _end)
+        {
+            char c = *_cur;
+            if(c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\f' || c == '\v')
+                ++_cur;
+            else if(c == '#' && (_cur == _beg || _cur[-1] == '\n'))
+                skipLine();
+            else if(c == '/' && _cur + 1 < _end && _cur[1] == '/')
+                skipLine();
+            else if(c == '/' && _cur + 1 < _end && _cur[1] == '*')
+            {
+                const char* from = _cur;
+                for(_cur += 2; _cur + 1 < _end && !(_cur[0] == '*' && _cur[1] == '/'); ++_cur)
+                    ;
+                if(_cur + 1 >= _end)
+                    fail(from, "unterminated comment");
+                _cur += 2;
+            }
+            else
+                break;
+        }
+    }
+
+    void skipLine()
+    {
+        const void* nl = std::memchr(_cur, '\n', static_cast<size_t>(_end - _cur));
+        _cur = nl ? static_cast<const char*>(nl) : _end;
+    }
+
+    Token scan()
+    {
+        skipSpaces();
+        Token t = {TokenType::end, _cur, _cur, false};
+        if(_cur == _end)
+            return t;
+
+        char c = *_cur;
+        switch(c)
+        {
+        case '{': t.type = TokenType::lbrace; break;
+        case '}': t.type = TokenType::rbrace; break;
+        case '[': t.type = TokenType::lbracket; break;
+        case ']': t.type = TokenType::rbracket; break;
+        case '=': t.type = TokenType::equal; break;
+        case ';': t.type = TokenType::semicolon; break;
+        case ',': t.type = TokenType::comma; break;
+        case '"':
+            return scanQuoted();
+        case '-':
+            if(_cur + 1 < _end && (_cur[1] == '-' || _cur[1] == '>'))
+            {
+                t.type = _cur[1] == '-' ? TokenType::edgeOp : TokenType::arrow;
+                _cur += 2;
+                t.end = _cur;
+                return t;
+            }
+            return scanId();
+        default:
+            if(isIdChar(c))
+                return scanId();
+            fail(_cur, "unexpected character");
+        }
+
+        t.end = ++_cur;
+        return t;
+    }
+
+    /// An identifier or a numeral, possibly with a sign and an exponent.
+    Token scanId()
+    {
+        Token t = {TokenType::id, _cur, _cur, false};
+        ++_cur;
+        while(_cur < _end)
+        {
+            char c = *_cur;
+            if(isIdChar(c))
+                ++_cur;
+            else if((c == '-' || c == '+') && (_cur[-1] == 'e' || _cur[-1] == 'E')
+                    && _cur + 1 < _end && std::isdigit(static_cast<unsigned char>(_cur[1])))
+                ++_cur;
+            else
+                break;
+        }
+        t.end = _cur;
+        return t;
+    }
+
+    Token scanQuoted()
+    {
+        const char* from = _cur++;
+        Token t = {TokenType::quoted, _cur, _cur, false};
+        for(;;)
+        {
+            const char* q = static_cast<const char*>(
+                std::memchr(_cur, '"', static_cast<size_t>(_end - _cur)));
+            if(!q)
+                fail(from, "unterminated string");
+
+            // the quote is escaped by an odd number of backslashes
+            const char* b = q;
+            while(b > t.beg && b[-1] == '\\')
+                --b;
+            if(b != q)
+                t.escaped = true;
+            _cur = q + 1;
+            if((q - b) % 2 == 0)
+            {
+                t.end = q;
+                break;
+            }
+        }
+        if(!t.escaped)
+            t.escaped = std::memchr(t.beg, '\\', static_cast<size_t>(t.end - t.beg)) != nullptr;
+
+        return t;
+    }
+
+protected:
+    const char* _beg;
+    const char* _cur;
+    const char* _end;
+    Token _peeked;
+    bool _hasPeeked;
+}; // class Lexer
+
+
+//----<Parsing values>----
+
+inline bool parseValue(const char* b, const char* e, bool& v)
+{
+    if(e - b != 1 || (*b != '0' && *b != '1'))
+        return false;
+    v = *b == '1';
+    return true;
+}
+
+inline bool parseValue(const char* b, const char* e, char& v)
+{
+    if(e - b != 1)
+        return false;
+    v = *b;
+    return true;
+}
+
+inline bool parseValue(const char* b, const char* e, signed char& v)
+{
+    char c;
+    return parseValue(b, e, c) && ((v = static_cast<signed char>(c)), true);
+}
+
+inline bool parseValue(const char* b, const char* e, unsigned char& v)
+{
+    char c;
+    return parseValue(b, e, c) && ((v = static_cast<unsigned char>(c)), true);
+}
+
+inline bool parseValue(const char* b, const char* e, std::string& v)
+{
+    v.assign(b, e);
+    return true;
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, bool>::type
+parseValue(const char* b, const char* e, T& v)
+{
+    return parse::parseInteger(b, e, v);
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+parseValue(const char* b, const char* e, T& v)
+{
+    return parse::parseFloat(b, e, v);
+}
+
+/// Any other type is read by its operator>>.
+template <typename T>
+typename std::enable_if<!std::is_arithmetic<T>::value, bool>::type
+parseValue(const char* b, const char* e, T& v)
+{
+    std::istringstream in(std::string(b, e));
+    return (in >> v) && (in >> std::ws).eof();
+}
+
+} // namespace dot_reader_details
+
+
+/*! ****************************************************************************
+ *  \brief Reads DOT files made by EdgeLblUGraphDotWriter into EdgeLblUGraph.
+ *
+ *  The file is mapped to memory and split into tokens referring right to the
+ *  mapping; only escaped strings are copied, into a reused buffer. Vertices
+ *  and edges are collected into batches of \a batchSize elements that are
+ *  added by EdgeLblUGraph::addVertices(), addEdges() and addLblEdges().
+ *
+ *  Supports an undirected graph with an optional name, vertex and edge
+ *  statements (with chains a -- b -- c), attribute lists of which only the
+ *  edge "label" is used, default attribute statements (node [...]) and graph
+ *  attributes (label = "..."), which are skipped except the label. Any other
+ *  DOT (directed graphs, subgraphs, ports, HTML strings...) is rejected by
+ *  std::invalid_argument with the line number, as well as values that can't
+ *  be converted to \a Vertex or \a EdgeLbl.
+ ******************************************************************************/
+template <typename Vertex, typename EdgeLbl>
+class EdgeLblUGraphDotReader {
+public:
+    typedef EdgeLblUGraph<Vertex, EdgeLbl> Graph;
+    typedef typename Graph::Edge Edge;
+    typedef typename Graph::LblEdge LblEdge;
+    typedef dot_reader_details::Token Token;
+    typedef dot_reader_details::TokenType TokenType;
+
+public:
+    explicit EdgeLblUGraphDotReader(size_t batchSize = 1 << 16)
+        : _batchSize(batchSize ? batchSize : 1)
+    {
+    }
+
+public:
+    /// Reads the file \a fn adding its vertices and edges to \a g.
+    void read(const std::string& fn, Graph& g)
+    {
+        MappedFile file(fn);
+        read(file.getData(), file.getSize(), g);
+    }
+
+    /// Reads the DOT text of \a size bytes at \a data adding its vertices and
+    /// edges to \a g. On errors, some of them may have been added already.
+    void read(const char* data, size_t size, Graph& g)
+    {
+        _label.clear();
+        _vertices.clear();
+        _edges.clear();
+        _lblEdges.clear();
+
+        dot_reader_details::Lexer lx(data, size);
+        Token t = lx.next();
+        if(isKeyword(t, "strict"))
+            lx.fail(t.beg, "strict graphs are not supported");
+        if(isKeyword(t, "digraph"))
+            lx.fail(t.beg, "directed graphs are not supported");
+        if(!isKeyword(t, "graph"))
+            lx.fail(t.beg, "'graph' expected");
+
+        t = lx.next();
+        if(t.type == TokenType::id || t.type == TokenType::quoted)
+            t = lx.next();                      // the name is not used
+        if(t.type != TokenType::lbrace)
+            lx.fail(t.beg, "'{' expected");
+
+        for(;;)
+        {
+            t = lx.next();
+            if(t.type == TokenType::rbrace)
+                break;
+            if(t.type == TokenType::semicolon)
+                continue;
+            readStatement(lx, t, g);
+        }
+
+        t = lx.next();
+        if(t.type != TokenType::end)
+            lx.fail(t.beg, "end of file expected after the graph");
+
+        flush(g);
+    }
+
+    /// Returns the label of the graph read last, if any.
+    const std::string& getLabel() const { return _label; }
+
+protected:
+    static bool isKeyword(const Token& t, const char* kw)
+    {
+        if(t.type != TokenType::id)
+            return false;
+        size_t n = std::strlen(kw);
+        if(static_cast<size_t>(t.end - t.beg) != n)
+            return false;
+        for(size_t i = 0; i < n; ++i)
+            if(std::tolower(static_cast<unsigned char>(t.beg[i])) != kw[i])
+                return false;
+        return true;
+    }
+
+    static bool isValue(const Token& t)
+    {
+        return t.type == TokenType::id || t.type == TokenType::quoted;
+    }
+
+    /// Returns the content of a value token, unescaping \" and \\ (as
+    /// DefaultDotVisitor::makeEscapedString() escapes them) if needed.
+    void getValue(const Token& t, const char*& b, const char*& e)
+    {
+        b = t.beg;
+        e = t.end;
+        if(!t.escaped)
+            return;
+
+        _tmp.clear();
+        for(const char* p = t.beg; p < t.end; ++p)
+        {
+            if(*p == '\\' && p + 1 < t.end && (p[1] == '"' || p[1] == '\\'))
+                ++p;
+            _tmp += *p;
+        }
+        b = _tmp.data();
+        e = b + _tmp.size();
+    }
+
+    template <typename T>
+    void parse(dot_reader_details::Lexer& lx, const Token& t, T& v, const char* what)
+    {
+        const char* b;
+        const char* e;
+        getValue(t, b, e);
+        if(!dot_reader_details::parseValue(b, e, v))
+            lx.fail(t.beg, what);
+    }
+
+    /// Reads the statement starting with the token \a t.
+    void readStatement(dot_reader_details::Lexer& lx, Token t, Graph& g)
+    {
+        if(t.type == TokenType::lbrace || isKeyword(t, "subgraph"))
+            lx.fail(t.beg, "subgraphs are not supported");
+
+        // default attributes
+        if(isKeyword(t, "graph") || isKeyword(t, "node") || isKeyword(t, "edge"))
+        {
+            if(lx.peek().type != TokenType::lbracket)
+                lx.fail(lx.peek().beg, "'[' expected");
+            readAttributes(lx, nullptr);
+            return;
+        }
+
+        if(!isValue(t))
+            lx.fail(t.beg, "statement expected");
+
+        // graph attribute
+        if(lx.peek().type == TokenType::equal)
+        {
+            Token name = t;
+            lx.next();
+            t = lx.next();
+            if(!isValue(t))
+                lx.fail(t.beg, "attribute value expected");
+            if(name.type == TokenType::id && std::string(name.beg, name.end) == "label")
+            {
+                const char* b;
+                const char* e;
+                getValue(t, b, e);
+                _label.assign(b, e);
+            }
+            return;
+        }
+
+        if(lx.peek().type == TokenType::arrow)
+            lx.fail(lx.peek().beg, "directed edges are not supported");
+
+        Vertex v;
+        parse(lx, t, v, "bad vertex");
+
+        // vertex
+        if(lx.peek().type != TokenType::edgeOp)
+        {
+            _vertices.push_back(v);
+            if(lx.peek().type == TokenType::lbracket)
+                readAttributes(lx, nullptr);
+            if(_vertices.size() >= _batchSize)
+                flush(g);
+            return;
+        }
+
+        // edge chain
+        _chain.clear();
+        _chain.push_back(v);
+        while(lx.peek().type == TokenType::edgeOp)
+        {
+            lx.next();
+            t = lx.next();
+            if(t.type == TokenType::lbrace || isKeyword(t, "subgraph"))
+                lx.fail(t.beg, "subgraphs are not supported");
+            if(!isValue(t))
+                lx.fail(t.beg, "vertex expected");
+            parse(lx, t, v, "bad vertex");
+            _chain.push_back(v);
+        }
+        if(lx.peek().type == TokenType::arrow)
+            lx.fail(lx.peek().beg, "directed edges are not supported");
+
+        EdgeLbl lbl;
+        bool hasLbl = false;
+        if(lx.peek().type == TokenType::lbracket)
+            hasLbl = readAttributes(lx, &lbl);
+
+        for(size_t i = 1; i < _chain.size(); ++i)
+        {
+            if(hasLbl)
+                _lblEdges.push_back({Edge(_chain[i - 1], _chain[i]), lbl});
+            else
+                _edges.push_back(Edge(_chain[i - 1], _chain[i]));
+        }
+        if(_edges.size() >= _batchSize || _lblEdges.size() >= _batchSize)
+            flush(g);
+    }
+
+    /// Reads one or more attribute lists; returns true if \a lbl is given and
+    /// the lists contain a label, which is parsed into \a lbl.
+    bool readAttributes(dot_reader_details::Lexer& lx, EdgeLbl* lbl)
+    {
+        bool hasLbl = false;
+        while(lx.peek().type == TokenType::lbracket)
+        {
+            lx.next();
+            for(;;)
+            {
+                Token name = lx.next();
+                if(name.type == TokenType::rbracket)
+                    break;
+                if(name.type == TokenType::comma || name.type == TokenType::semicolon)
+                    continue;
+                if(!isValue(name))
+                    lx.fail(name.beg, "attribute name expected");
+                Token eq = lx.next();
+                if(eq.type != TokenType::equal)
+                    lx.fail(eq.beg, "'=' expected");
+                Token val = lx.next();
+                if(!isValue(val))
+                    lx.fail(val.beg, "attribute value expected");
+
+                if(lbl && name.type == TokenType::id && name.end - name.beg == 5
+                   && std::memcmp(name.beg, "label", 5) == 0)
+                {
+                    parse(lx, val, *lbl, "bad label");
+                    hasLbl = true;
+                }
+            }
+        }
+        return hasLbl;
+    }
+
+    /// Adds the collected batches to \a g.
+    void flush(Graph& g)
+    {
+        if(!_vertices.empty())
+            g.addVertices(std::move(_vertices));
+        if(!_edges.empty())
+            g.addEdges(std::move(_edges));
+        if(!_lblEdges.empty())
+            g.addLblEdges(std::move(_lblEdges));
+        _vertices.clear();
+        _edges.clear();
+        _lblEdges.clear();
+    }
+
+protected:
+    size_t _batchSize;
+    std::string _label;             ///< Label of the graph.
+    std::string _tmp;               ///< Unescaped value.
+    std::vector<Vertex> _chain;     ///< Vertices of an edge statement.
+    std::vector<Vertex> _vertices;  ///< Batch of vertices.
+    std::vector<Edge> _edges;       ///< Batch of unlabeled edges.
+    std::vector<LblEdge> _lblEdges; ///< Batch of labeled edges.
+}; // class EdgeLblUGraphDotReader
+
+
+#endif // GRVIZ_DOT_READER_HPP
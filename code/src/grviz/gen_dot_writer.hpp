@@ -16,9 +16,25 @@
 #define XI_LDOPA_GRAPHS_GRVIZ_GEN_DOT_WRITER_H_
 
 // std
+#include <algorithm>
+#include <cstring>
 #include <list>
 #include <string>
 #include <fstream>
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <streambuf>
+#include <type_traits>
+#include <vector>
+
+#include "../ugraph/par_utils.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define GRVIZ_HAS_FD
+#include <cerrno>
+#include <unistd.h>
+#endif
 
 namespace xi { namespace ldopa { namespace graph {
 
@@ -154,6 +170,338 @@ struct DefaultDotVisitor
 //=============================================================================
 
 
+/*! ****************************************************************************
+ *  \brief Reusable byte buffer for fast formatting of DOT output.
+ *
+ *  Values are formatted right into the buffer, which is written to the
+ *  attached stream by large blocks. Integers and strings are copied by
+ *  hand; values of any other type are formatted by their operator<< through
+ *  an internal stream writing to the same buffer, so the output is the same
+ *  as with a std::ostream, without temporary strings. The memory of the
+ *  buffer is kept between uses.
+ ******************************************************************************/
+class DotOutBuffer : private std::streambuf {
+public:
+    //----<Constructors>----
+    explicit DotOutBuffer(size_t capacity = 1 << 20)
+        : _data(capacity ? capacity : 1), _size(0), _hold(false), _out(nullptr),
+          _os(this)
+    {
+    }
+
+    /// Copies only the capacity: buffers are never shared.
+    DotOutBuffer(const DotOutBuffer& other)
+        : DotOutBuffer(other._data.size())
+    {
+    }
+
+    DotOutBuffer& operator=(const DotOutBuffer&)
+    {
+        return *this;
+    }
+
+public:
+    /// Attaches the buffer to \a out, dropping anything left from an
+    /// interrupted output.
+    void attach(std::ostream& out)
+    {
+        _size = 0;
+        _out = &out;
+    }
+
+    /// Flushes the buffer and detaches it from the stream; must be called
+    /// before the stream is gone.
+    void detach()
+    {
+        flush();
+        _out = nullptr;
+    }
+
+    /// Writes the content of the buffer to the attached stream, if any.
+    void flush()
+    {
+        if(!_out)
+            return;
+        if(_size)
+            _out->write(_data.data(), static_cast<std::streamsize>(_size));
+        _size = 0;
+    }
+
+    /// Returns the content not flushed yet.
+    std::string getPending() const { return std::string(_data.data(), _size); }
+
+    /// Writes the content not flushed yet to \a out and empties the buffer.
+    void writeTo(std::ostream& out)
+    {
+        if(_size)
+            out.write(_data.data(), static_cast<std::streamsize>(_size));
+        _size = 0;
+    }
+
+    /// Drops the content not flushed yet.
+    void clear() { _size = 0; }
+
+    /// Sets the precision of floating-point values formatted by putValue().
+    void setPrecision(int precision) { _os.precision(precision); }
+
+    //----<Raw output>----
+    void put(char c)
+    {
+        if(_size == _data.size())
+            makeRoom(1);
+        _data[_size++] = c;
+    }
+
+    void put(const char* s, size_t n)
+    {
+        if(_size + n > _data.size())
+        {
+            makeRoom(n);
+            if(!_hold && _out && n > _data.size())
+            {
+                _out->write(s, static_cast<std::streamsize>(n));    // too large to copy
+                return;
+            }
+        }
+        std::memcpy(_data.data() + _size, s, n);
+        _size += n;
+    }
+
+    void put(const char* s) { put(s, std::strlen(s)); }
+
+    //----<Formatted output>----
+    void putValue(bool b) { put(b ? '1' : '0'); }
+    void putValue(char c) { put(c); }
+    void putValue(signed char c) { put(static_cast<char>(c)); }
+    void putValue(unsigned char c) { put(static_cast<char>(c)); }
+    void putValue(const char* s) { put(s); }
+    void putValue(const std::string& s) { put(s.data(), s.size()); }
+
+    /// Formats an integer the same way as std::ostream does by default.
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value>::type putValue(const T& v)
+    {
+        typedef typename std::make_unsigned<T>::type U;
+
+        char tmp[24];
+        char* end = tmp + sizeof(tmp);
+        char* p = end;
+        U u = static_cast<U>(v);
+        bool neg = v < T();
+        if(neg)
+            u = U(0) - u;
+        while(u >= 100)
+        {
+            const char* d = getDigitPairs() + (u % 100) * 2;
+            u /= 100;
+            *--p = d[1];
+            *--p = d[0];
+        }
+        if(u >= 10)
+        {
+            const char* d = getDigitPairs() + u * 2;
+            *--p = d[1];
+            *--p = d[0];
+        }
+        else
+            *--p = static_cast<char>('0' + u);
+        if(neg)
+            *--p = '-';
+
+        put(p, static_cast<size_t>(end - p));
+    }
+
+    /// Formats a value of any other type by its operator<<.
+    template <typename T>
+    typename std::enable_if<!std::is_integral<T>::value>::type putValue(const T& v)
+    {
+        _os << v;
+    }
+
+    /// \brief Outputs the value \a v enclosed into double quotes with double
+    /// quotes and backslashes escaped, as DefaultDotVisitor::makeEscapedString()
+    /// does.
+    ///
+    /// The value is formatted into the buffer and then escaped in place.
+    template <typename T>
+    void putEscapedValue(const T& v)
+    {
+        put('"');
+        bool held = _hold;
+        _hold = true;               // the value must stay in the buffer
+        size_t beg = _size;
+        putValue(v);
+
+        size_t specials = 0;
+        for(size_t i = beg; i < _size; ++i)
+            if(_data[i] == '"' || _data[i] == '\\')
+                ++specials;
+        if(specials)
+        {
+            if(_size + specials > _data.size())
+                makeRoom(specials);
+            size_t src = _size, dst = _size + specials;
+            while(src > beg)
+            {
+                char c = _data[--src];
+                _data[--dst] = c;
+                if(c == '"' || c == '\\')
+                    _data[--dst] = '\\';
+            }
+            _size += specials;
+        }
+
+        _hold = held;
+        put('"');
+    }
+
+protected:
+    /// Flushes the buffer (larger blocks are then written directly by put()),
+    /// or grows it if the content must be kept or there is no stream.
+    void makeRoom(size_t n)
+    {
+        if(!_hold && _out)
+            flush();
+        else if(_size + n > _data.size())
+            _data.resize(std::max(_data.size() * 2, _size + n));
+    }
+
+    static const char* getDigitPairs()
+    {
+        return "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+               "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+               "8081828384858687888990919293949596979899";
+    }
+
+    //----<std::streambuf overrides>----
+    int_type overflow(int_type c) override
+    {
+        if(!traits_type::eq_int_type(c, traits_type::eof()))
+            put(traits_type::to_char_type(c));
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override
+    {
+        put(s, static_cast<size_t>(n));
+        return n;
+    }
+
+protected:
+    std::vector<char> _data;
+    size_t _size;               ///< Bytes used.
+    bool _hold;                 ///< Grow instead of flushing.
+    std::ostream* _out;         ///< Attached stream.
+    std::ostream _os;           ///< Formats arbitrary values into the buffer.
+}; // class DotOutBuffer
+
+//=============================================================================
+
+
+/*! ****************************************************************************
+ *  \brief Stream buffer passing the output to a callback by blocks.
+ *
+ *  Makes a std::ostream out of any sink: a pipe, a socket, a compressor or
+ *  a memory buffer. The callback gets blocks of at most the size of the
+ *  buffer, except larger blocks written at once, which are passed through
+ *  without copying. An exception thrown by the callback reaches the writer
+ *  if the stream has badbit set in its exceptions() mask.
+ *
+ *  The buffer is not flushed in the destructor: flush the stream (or call
+ *  pubsync()) when done.
+ ******************************************************************************/
+class DotSinkBuffer : public std::streambuf {
+public:
+    /// Sink callback: gets a block of \a n bytes at \a data.
+    typedef std::function<void(const char* data, size_t n)> WriteFunc;
+
+public:
+    explicit DotSinkBuffer(const WriteFunc& f, size_t bufSize = 1 << 16)
+        : _f(f), _data(bufSize ? bufSize : 1)
+    {
+        setp(_data.data(), _data.data() + _data.size());
+    }
+
+    DotSinkBuffer(const DotSinkBuffer&) = delete;
+    DotSinkBuffer& operator=(const DotSinkBuffer&) = delete;
+
+#ifdef GRVIZ_HAS_FD
+    /// Makes a callback writing to the file descriptor \a fd, which is not
+    /// closed; throws std::invalid_argument if writing fails.
+    static WriteFunc makeFdWriter(int fd)
+    {
+        return [fd](const char* data, size_t n)
+        {
+            while(n)
+            {
+                ssize_t res = ::write(fd, data, n);
+                if(res < 0)
+                {
+                    if(errno == EINTR)
+                        continue;
+                    throw std::invalid_argument("Can't write to the file descriptor");
+                }
+                data += res;
+                n -= static_cast<size_t>(res);
+            }
+        };
+    }
+#endif
+
+protected:
+    /// Passes the buffered data to the sink.
+    void writeOut()
+    {
+        size_t n = static_cast<size_t>(pptr() - pbase());
+        setp(_data.data(), _data.data() + _data.size());
+        if(n)
+            _f(_data.data(), n);
+    }
+
+    //----<std::streambuf overrides>----
+    int_type overflow(int_type c) override
+    {
+        writeOut();
+        if(!traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override
+    {
+        size_t len = static_cast<size_t>(n);
+        if(len <= static_cast<size_t>(epptr() - pptr()))
+        {
+            std::memcpy(pptr(), s, len);
+            pbump(static_cast<int>(n));
+        }
+        else if(len < _data.size())
+            return std::streambuf::xsputn(s, n);
+        else
+        {
+            writeOut();
+            _f(s, len);
+        }
+        return n;
+    }
+
+    int sync() override
+    {
+        writeOut();
+        return 0;
+    }
+
+protected:
+    WriteFunc _f;
+    std::vector<char> _data;
+}; // class DotSinkBuffer
+
+//=============================================================================
+
+
 /*! ****************************************************************************
  *  \brief Generic DOT-writer.
  *
@@ -180,19 +528,104 @@ public:
         if (!dfile.is_open())
             throw std::invalid_argument("Can't open dump file for GraphViz");
 
+        write(dfile, gr, grLbl);
+    }
+
+    /// Writes a dump of the given model \a gr to the stream \a str, which is
+    /// flushed at the end.
+    void write(std::ostream& str, const TGraph& gr, const char* grLbl = nullptr)
+    {
         // заголовок
-        outputHeader(dfile, gr, grLbl);
+        outputHeader(str, gr, grLbl);
 
         // тело
-        outputBody(dfile, gr);
+        outputBody(str, gr);
 
         // хвост
-        outputTail(dfile, gr);
+        outputTail(str, gr);
+
+        str.flush();
+    }
+
+    /// \brief Writes a dump of the given model \a gr by calling \a f for
+    /// blocks of up to \a bufSize bytes.
+    ///
+    /// Exceptions thrown by \a f are passed to the caller.
+    void writeToSink(const DotSinkBuffer::WriteFunc& f, const TGraph& gr,
+                     const char* grLbl = nullptr, size_t bufSize = 1 << 16)
+    {
+        DotSinkBuffer sbuf(f, bufSize);
+        std::ostream str(&sbuf);
+        str.exceptions(std::ios::badbit);
+        write(str, gr, grLbl);
+    }
+
+#ifdef GRVIZ_HAS_FD
+    /// Writes a dump of the given model \a gr to the open file descriptor
+    /// \a fd (a pipe, a socket...) by blocks of \a bufSize bytes.
+    void writeToFd(int fd, const TGraph& gr, const char* grLbl = nullptr,
+                   size_t bufSize = 1 << 16)
+    {
+        writeToSink(DotSinkBuffer::makeFdWriter(fd), gr, grLbl, bufSize);
+    }
+#endif
+
+    /// \brief Writes the model \a gr like write() does, formatting the body
+    /// on \a threadsNum threads (0 means all hardware threads).
+    ///
+    /// The visitor splits the body into consecutive chunks, which are
+    /// formatted concurrently into separate buffers and written strictly in
+    /// order, so the output is the same as the one of write(). At most a few
+    /// chunks per thread are kept in memory at once. Requires the visitor to
+    /// provide makeChunks() and outputChunk() (see EdgeLblUGraphDotVisitor).
+    void writeParallel(const std::string& fn, const TGraph& gr,
+                       unsigned threadsNum = 0, const char* grLbl = nullptr)
+    {
+        std::ofstream dfile(fn.c_str());
+        if (!dfile.is_open())
+            throw std::invalid_argument("Can't open dump file for GraphViz");
 
-        dfile.flush();
+        writeParallel(dfile, gr, threadsNum, grLbl);
+    }
+
+    /// Writes the model \a gr to the stream \a str, which is flushed at the
+    /// end; see the method above.
+    void writeParallel(std::ostream& str, const TGraph& gr,
+                       unsigned threadsNum = 0, const char* grLbl = nullptr)
+    {
+        outputHeader(str, gr, grLbl);
+        outputBodyParallel(str, gr, par::getThreadsNum(threadsNum));
+        outputTail(str, gr);
+        str.flush();
     }
 
 protected:
+    /// Chunks formatted per thread before the formatted ones are written.
+    static const size_t CHUNKS_PER_THREAD = 4;
+
+    /// Outputs the body formatting it by windows of consecutive chunks.
+    void outputBodyParallel(std::ostream& str, const TGraph& gr, unsigned threadsNum)
+    {
+        // more chunks than threads balance uneven chunks
+        size_t chunksNum = _gv.makeChunks(gr, threadsNum * CHUNKS_PER_THREAD * 4);
+        size_t window = std::min<size_t>(chunksNum, threadsNum * CHUNKS_PER_THREAD);
+        _bufs.resize(std::max(_bufs.size(), window), DotOutBuffer(1 << 16));
+
+        const TGraphVisitor& gv = _gv;
+        for(size_t base = 0; base < chunksNum; base += window)
+        {
+            size_t n = std::min(window, chunksNum - base);
+            par::parallelFor(n, threadsNum, [&](size_t i, unsigned)
+            {
+                _bufs[i].clear();
+                gv.outputChunk(_bufs[i], gr, base + i);
+            }, 1);
+
+            for(size_t i = 0; i < n; ++i)
+                _bufs[i].writeTo(str);
+        }
+    }
+
     /// Outputs the main part (vertices and edges) of the graph to the output.
     inline void outputBody(std::ostream& str, const TGraph& gr)
     {
@@ -215,6 +648,9 @@ protected:
     
     /** \brief Graph Visitor object. */
     TGraphVisitor _gv;
+
+    /** \brief Chunk buffers of writeParallel(), kept between calls. */
+    std::vector<DotOutBuffer> _bufs;
 }; // class GenDotWriter 
 
 
@@ -16,7 +16,10 @@
 #ifndef UGRAPH_HPP_
 #define UGRAPH_HPP_
 
-#include <sstream>
+#include <algorithm>
+#include <iterator>
+#include <ostream>
+#include <vector>
 
 #include "gen_dot_writer.hpp"
 #include "../ugraph/lbl_ugraph.hpp"
@@ -34,33 +37,136 @@ struct EdgeLblUGraphDotVisitor :
 
     EdgeLblUGraphDotVisitor() : Base(Base::Sort::graph) {}
 
+    /// \brief Outputs vertices and edges of the graph \a g to \a str.
+    ///
+    /// Everything is formatted into a reusable buffer written to \a str by
+    /// large blocks; labels are escaped right in the buffer. The output is
+    /// the same as with formatting by ParamValueList, makeEscapedString()
+    /// and makeParamValueStr() and streaming every line.
     void outputBody(std::ostream& str, const Graph& g)
     {
-        // enumerates all vertices
+        _buf.attach(str);
+
+        typename Graph::VertexIterPair vs = g.getVertices();
+        outputVertices(_buf, vs.first, vs.second);
+        outputEdges(_buf, g, vs.first, vs.second);
+
+        _buf.detach();
+    }
+
+    /// \brief Splits the body of \a g into about \a chunksNum chunks for
+    /// GenDotWriter::writeParallel() and returns the actual number of them.
+    ///
+    /// The vertices go first, split by equal ranges; then the edges, grouped
+    /// by their smaller vertex, split by ranges of vertices with about the
+    /// same total degree. Concatenated in order, the chunks make the same
+    /// output as outputBody().
+    size_t makeChunks(const Graph& g, size_t chunksNum)
+    {
+        _chunks.clear();
+        size_t vertsNum = g.getVerticesNum();
+        if(vertsNum == 0)
+            return 0;
+
+        size_t perChunk = std::max<size_t>(1, vertsNum / std::max<size_t>(1, chunksNum));
+        size_t perEdgeChunk = std::max<size_t>(1, 2 * g.getEdgesNum()
+                                                  / std::max<size_t>(1, chunksNum));
+
         typename Graph::VertexIterPair vs = g.getVertices();
+        typename Graph::VertexIter vertFrom = vs.first, edgeFrom = vs.first;
+        size_t verts = 0, degrees = 0;
+        std::vector<Chunk> edgeChunks;
         for(typename Graph::VertexIter it = vs.first; it != vs.second; ++it)
         {
-            str << *it << "\n";     // see code below for example how to add params
+            if(verts == perChunk)
+            {
+                _chunks.push_back({vertFrom, it, false});
+                vertFrom = it;
+                verts = 0;
+            }
+            if(degrees >= perEdgeChunk)
+            {
+                edgeChunks.push_back({edgeFrom, it, true});
+                edgeFrom = it;
+                degrees = 0;
+            }
+            ++verts;
+            degrees += g.getDegree(*it);
         }
+        _chunks.push_back({vertFrom, vs.second, false});
+        edgeChunks.push_back({edgeFrom, vs.second, true});
+        _chunks.insert(_chunks.end(), edgeChunks.begin(), edgeChunks.end());
 
-        // enumerates all edges
-        typename Graph::EdgeIterPair es = g.getEdges();
-        for(typename Graph::EdgeIter it = es.first; it != es.second; ++it)
+        return _chunks.size();
+    }
+
+    /// Outputs the chunk number \a chunk made by makeChunks() to \a buf;
+    /// different chunks can be output concurrently.
+    void outputChunk(xi::ldopa::graph::DotOutBuffer& buf, const Graph& g,
+                     size_t chunk) const
+    {
+        const Chunk& ch = _chunks[chunk];
+        if(ch.edges)
+            outputEdges(buf, g, ch.from, ch.to);
+        else
+            outputVertices(buf, ch.from, ch.to);
+    }
+
+protected:
+    /// A range of vertices, or of edges of these vertices.
+    struct Chunk {
+        typename Graph::VertexIter from, to;
+        bool edges;
+    };
+
+    static void outputVertices(xi::ldopa::graph::DotOutBuffer& buf,
+                               typename Graph::VertexIter from,
+                               typename Graph::VertexIter to)
+    {
+        for(typename Graph::VertexIter it = from; it != to; ++it)
+        {
+            buf.putValue(*it);
+            buf.put('\n');
+        }
+    }
+
+    /// Outputs the edges listed in the adjacency list of vertices [from, to),
+    /// each one by its smaller vertex.
+    static void outputEdges(xi::ldopa::graph::DotOutBuffer& buf, const Graph& g,
+                            typename Graph::VertexIter from,
+                            typename Graph::VertexIter to)
+    {
+        if(from == to)
+            return;
+
+        // the adjacency list is ordered by vertices as the set of them
+        typename Graph::AdjListCIter adjFrom = g.getAdjEdges(*from).first;
+        typename Graph::AdjListCIter adjTo = (to == g.getVertices().second)
+                ? g.getAdjEdges(*std::prev(to)).second
+                : g.getAdjEdges(*to).first;
+
+        typename Graph::EdgeIter end(adjTo, adjTo);
+        for(typename Graph::EdgeIter it(adjFrom, adjTo); it != end; ++it)
         {
-            typename Base::ParamValueList pars;    // edge attributes
+            buf.putValue(it->first);
+            buf.put(" -- ", 4);
+            buf.putValue(it->second);
+            buf.put(' ');
+
             EdgeLbl lbl;
             if(g.getLabel(it->first, it->second, lbl))
             {
-                // use string stream to convert an arbitrary type EdgeLbl to a string
-                std::stringstream ss;
-                ss << lbl;
-                pars.append("label", Base::makeEscapedString(ss.str()));
+                buf.put("[label=", 7);
+                buf.putEscapedValue(lbl);
+                buf.put(']');
             }
-
-            str << it->first << " -- " << it->second
-                << " " << Base::makeParamValueStr(pars)  << "\n";
+            buf.put('\n');
         }
     }
+
+protected:
+    xi::ldopa::graph::DotOutBuffer _buf;    ///< Kept between outputs.
+    std::vector<Chunk> _chunks;             ///< Made by makeChunks().
 };
 
 
@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains portable helpers for bit manipulations.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BIT_UTILS_HPP
+#define BIT_UTILS_HPP
+
+#include <cstdint>
+
+
+namespace bits {
+
+/// Returns the index of the lowest set bit of \a x; \a x must be non-zero.
+inline unsigned countTrailingZeros(std::uint64_t x)
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_ctzll(x));
+#else
+    unsigned n = 0;
+    for(; !(x & 1); x >>= 1)
+        ++n;
+    return n;
+#endif
+}
+
+/// Returns the number of significant bits of \a x, i.e. 64 minus the number
+/// of leading zeros; 0 for \a x == 0.
+inline unsigned getBitWidth(std::uint64_t x)
+{
+#if defined(__GNUC__)
+    return x ? 64 - static_cast<unsigned>(__builtin_clzll(x)) : 0;
+#else
+    unsigned n = 0;
+    for(; x; x >>= 1)
+        ++n;
+    return n;
+#endif
+}
+
+/// Returns the number of set bits of \a x.
+inline unsigned popCount(std::uint64_t x)
+{
+#if defined(__GNUC__)
+    return static_cast<unsigned>(__builtin_popcountll(x));
+#else
+    unsigned n = 0;
+    for(; x; x &= x - 1)
+        ++n;
+    return n;
+#endif
+}
+
+/// \brief Scrambles the bits of \a x (SplitMix64 finalizer).
+///
+/// Gives reproducible pseudo-random values for any element independently of
+/// the order in which threads visit the elements: mix64(seed ^ mix64(id)).
+inline std::uint64_t mix64(std::uint64_t x)
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+} // namespace bits
+
+
+#endif // BIT_UTILS_HPP
@@ -0,0 +1,407 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains a read-only undirected graph with compressed adjacency
+///             lists.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef COMPRESSED_UGRAPH_HPP
+#define COMPRESSED_UGRAPH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <vector>
+
+#include "csr_ugraph.hpp"
+#include "par_utils.hpp"
+
+
+namespace compressed_details {
+
+/// Neighbours per block of a list; larger lists have skip pointers to blocks.
+const std::uint32_t BLOCK_SIZE = 64;
+
+/// Skip pointer to a block of a list.
+struct Skip {
+    std::uint32_t first;    ///< The first neighbour of the block.
+    std::uint32_t pos;      ///< Position of the second one from the list data.
+};
+
+/// Appends \a x as a LEB128 varint: 7 bits per byte, the high bit set in
+/// all the bytes but the last one.
+inline void writeVarint(std::vector<std::uint8_t>& out, std::uint32_t x)
+{
+    while(x >= 0x80)
+    {
+        out.push_back(static_cast<std::uint8_t>(x | 0x80));
+        x >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(x));
+}
+
+/// Reads a varint at \a p and moves \a p past it.
+inline std::uint32_t readVarint(const std::uint8_t*& p)
+{
+    std::uint32_t x = *p++;
+    if(x < 0x80)                            // most gaps are small
+        return x;
+
+    x &= 0x7f;
+    for(unsigned shift = 7; ; shift += 7)
+    {
+        std::uint32_t b = *p++;
+        x |= (b & 0x7f) << shift;
+        if(b < 0x80)
+            return x;
+    }
+}
+
+/// Maps a difference modulo 2^32 to a small number if it is small by
+/// absolute value.
+inline std::uint32_t zigzag(std::uint32_t d)
+{
+    return (d << 1) ^ (0u - (d >> 31));
+}
+
+inline std::uint32_t unzigzag(std::uint32_t z)
+{
+    return (z >> 1) ^ (0u - (z & 1));
+}
+
+/// Returns the number of skip pointers of a list of \a degree neighbours.
+inline std::uint32_t getSkipsNum(std::uint32_t degree)
+{
+    return degree > BLOCK_SIZE ? (degree - 1) / BLOCK_SIZE : 0;
+}
+
+/// \brief Appends the encoded sorted list \a adj of the neighbours of the
+/// vertex \a v to \a out.
+///
+/// The list is its degree, the skip pointers to blocks 1, 2, ..., if any,
+/// and the neighbours: the first one relative to \a v, and each other one
+/// as the gap from the previous one minus 1.
+inline void encodeList(std::uint32_t v, const std::vector<std::uint32_t>& adj,
+                       std::vector<std::uint8_t>& out)
+{
+    std::uint32_t degree = static_cast<std::uint32_t>(adj.size());
+    writeVarint(out, degree);
+
+    size_t skipsPos = out.size();
+    out.resize(out.size() + getSkipsNum(degree) * sizeof(Skip));
+    size_t dataPos = out.size();
+    for(std::uint32_t i = 0; i < degree; ++i)
+    {
+        writeVarint(out, i == 0 ? zigzag(adj[0] - v) : adj[i] - adj[i - 1] - 1);
+        if(i % BLOCK_SIZE == 0 && i > 0)
+        {
+            Skip s = { adj[i], static_cast<std::uint32_t>(out.size() - dataPos) };
+            std::memcpy(out.data() + skipsPos + (i / BLOCK_SIZE - 1) * sizeof(Skip),
+                        &s, sizeof(Skip));
+        }
+    }
+}
+
+} // namespace compressed_details
+
+
+/*! ****************************************************************************
+ *  \brief The CompressedUGraph class represents a read-only snapshot of
+ *  a UGraph with compressed adjacency lists.
+ *
+ *  The same as CsrUGraph, except that the sorted neighbours of a vertex are
+ *  stored as varint-encoded gaps, which takes 1-2 bytes per neighbour
+ *  instead of 4 for graphs with locality (e.g. reordered ones), and an
+ *  8-byte offset per vertex. Lists longer than a block of 64 neighbours
+ *  start with skip pointers to the blocks, so a neighbour is found without
+ *  decoding the whole list.
+ *
+ *  The graph provides the getAdjVertices() iteration of the graph concept,
+ *  by a forward iterator decoding the list on the fly, so the algorithms
+ *  that only scan adjacency lists, such as findBfsDistances(),
+ *  findMultiSourceBfsDistances() and findComponentsAfforest(), run on it
+ *  directly. There is no getAdjOffset(): per-edge arrays are for CsrUGraph.
+ *
+ *  \tparam Vertex represents a type for vertices. See requirements for UGraph.
+ ******************************************************************************/
+template <typename Vertex>
+class CompressedUGraph {
+public:
+    // type definitions
+
+    /// Dense vertex id.
+    typedef std::uint32_t VId;
+
+    /// Forward iterator for adjacent vertices, decoding them one by one.
+    class AdjIter {
+    public:
+        typedef VId                         value_type;
+        typedef const VId&                  reference;
+        typedef const VId*                  pointer;
+        typedef std::forward_iterator_tag   iterator_category;
+        typedef std::ptrdiff_t              difference_type;
+
+    public:
+        /// Makes an end iterator.
+        AdjIter()
+            : _p(nullptr), _cur(0), _left(0)
+        {
+        }
+
+        /// Makes an iterator at the neighbour \a cur followed by \a left - 1
+        /// ones encoded at \a p.
+        AdjIter(const std::uint8_t* p, VId cur, std::uint32_t left)
+            : _p(p), _cur(cur), _left(left)
+        {
+        }
+
+        reference operator*() const { return _cur; }
+        pointer operator->() const { return &_cur; }
+
+        AdjIter& operator++()
+        {
+            if(--_left)
+                _cur += compressed_details::readVarint(_p) + 1;
+            return *this;
+        }
+
+        AdjIter operator++(int)
+        {
+            AdjIter tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        /// Iterators of the same list are equal if as many neighbours are left.
+        bool operator==(const AdjIter& rhv) const { return _left == rhv._left; }
+        bool operator!=(const AdjIter& rhv) const { return _left != rhv._left; }
+
+    protected:
+        const std::uint8_t* _p;     ///< The next encoded neighbour.
+        VId _cur;                   ///< The current neighbour.
+        std::uint32_t _left;        ///< Neighbours left, including the current.
+    }; // class AdjIter
+
+    /// Pair of adjacent vertices iterators.
+    typedef std::pair<AdjIter, AdjIter> AdjIterPair;
+
+public:
+    /// Creates an empty graph.
+    CompressedUGraph()
+        : _offsets(1, 0), _edgesNum(0)
+    {
+    }
+
+    /// Makes a compressed snapshot of the given graph \a g.
+    explicit CompressedUGraph(const UGraph<Vertex>& g, unsigned threadsNum = 0)
+        : _edgesNum(g.getEdgesNum())
+    {
+        typename UGraph<Vertex>::VertexIterPair vs = g.getVertices();
+        _vertices.assign(vs.first, vs.second);
+        build([&](VId v, std::vector<VId>& adj)
+        {
+            typename UGraph<Vertex>::AdjListCIterPair es = g.getAdjEdges(_vertices[v]);
+            for(auto it = es.first; it != es.second; ++it)
+                adj.push_back(static_cast<VId>(
+                    std::lower_bound(_vertices.begin(), _vertices.end(), it->second)
+                    - _vertices.begin()));
+
+            // a self-loop has two entries in the multimap
+            std::sort(adj.begin(), adj.end());
+            adj.erase(std::unique(adj.begin(), adj.end()), adj.end());
+        }, threadsNum);
+    }
+
+    /// Compresses the CSR graph \a g, keeping its dense ids.
+    explicit CompressedUGraph(const CsrUGraph<Vertex>& g, unsigned threadsNum = 0)
+        : _edgesNum(g.getEdgesNum()), _index(g.getVertexIndex())
+    {
+        _vertices.reserve(g.getVerticesNum());
+        for(VId v = 0; v < g.getVerticesNum(); ++v)
+            _vertices.push_back(g.getVertex(v));
+        build([&g](VId v, std::vector<VId>& adj)
+        {
+            typename CsrUGraph<Vertex>::AdjIterPair vs = g.getAdjVertices(v);
+            adj.assign(vs.first, vs.second);
+        }, threadsNum);
+    }
+
+public:
+    // setters/getters
+    size_t getVerticesNum() const { return _vertices.size(); }
+    size_t getEdgesNum() const { return _edgesNum; }
+
+    /// Returns the size of the encoded adjacency lists in bytes.
+    size_t getDataSize() const { return _data.size(); }
+
+    /// Returns the number of the neighbours of the vertex \a v in O(1); the
+    /// same as UGraph::getDegree(), i.e. a self-loop counts once.
+    size_t getDegree(VId v) const
+    {
+        const std::uint8_t* p = _data.data() + _offsets[v];
+        return compressed_details::readVarint(p);
+    }
+
+    /// Collects the statistics of vertex degrees in a single pass.
+    DegreeStats getDegreeStats() const
+    {
+        DegreeStats st;
+        for(VId v = 0; v < getVerticesNum(); ++v)
+            st.addDegree(getDegree(v));
+        st.finish(getVerticesNum());
+
+        return st;
+    }
+
+    /// Checks whether the vertex \a v has a self-loop; see hasEdge().
+    bool hasSelfLoop(VId v) const { return hasEdge(v, v); }
+
+    /// Checks whether there is an edge {\a v, \a u}, decoding at most a block
+    /// of the neighbours of \a v.
+    bool hasEdge(VId v, VId u) const
+    {
+        AdjIter it = findAdjVertex(v, u), end;
+        return it != end && *it == u;
+    }
+
+    /// \brief Returns the iterator at the first neighbour of the vertex \a v
+    /// that is not less than \a u, or the end one.
+    ///
+    /// The block that may contain \a u is found by a binary search over the
+    /// skip pointers and only it is decoded.
+    AdjIter findAdjVertex(VId v, VId u) const
+    {
+        using namespace compressed_details;
+
+        const std::uint8_t* p = _data.data() + _offsets[v];
+        std::uint32_t degree = readVarint(p);
+        const std::uint8_t* skips = p;
+        std::uint32_t skipsNum = getSkipsNum(degree);
+        p += skipsNum * sizeof(Skip);
+        if(degree == 0)
+            return AdjIter();
+
+        // the last block starting not after u
+        std::uint32_t lo = 0, hi = skipsNum;
+        Skip s;
+        while(lo < hi)
+        {
+            std::uint32_t mid = (lo + hi + 1) / 2;
+            std::memcpy(&s, skips + (mid - 1) * sizeof(Skip), sizeof(Skip));
+            if(s.first <= u)
+                lo = mid;
+            else
+                hi = mid - 1;
+        }
+
+        AdjIter it;
+        if(lo == 0)
+        {
+            VId first = v + unzigzag(readVarint(p));
+            it = AdjIter(p, first, degree);
+        }
+        else
+        {
+            std::memcpy(&s, skips + (lo - 1) * sizeof(Skip), sizeof(Skip));
+            it = AdjIter(p + s.pos, s.first, degree - lo * BLOCK_SIZE);
+        }
+
+        AdjIter end;
+        for(std::uint32_t i = 0; i < BLOCK_SIZE && it != end && *it < u; ++i)
+            ++it;
+
+        return it;
+    }
+
+    /// Returns the original vertex by its dense id \a v.
+    const Vertex& getVertex(VId v) const { return _vertices[v]; }
+
+    /// For a given vertex \a v tries to find its dense id.
+    ///
+    /// \return true if the vertex exists and \a id is assigned to its dense
+    /// id; false otherwise.
+    bool getVId(const Vertex& v, VId& id) const
+    {
+        return csr_details::findVId(_vertices.data(), _vertices.size(),
+                                    _index.empty() ? nullptr : _index.data(), v, id);
+    }
+
+    /// Returns the dense ids ordered by their vertices if the graph is
+    /// reordered, or an empty vector; see CsrUGraph::getVertexIndex().
+    const std::vector<VId>& getVertexIndex() const { return _index; }
+
+    /// Return a sorted range of dense ids of the neighbours of the vertex \a v.
+    AdjIterPair getAdjVertices(VId v) const
+    {
+        const std::uint8_t* p = _data.data() + _offsets[v];
+        std::uint32_t degree = compressed_details::readVarint(p);
+        if(degree == 0)
+            return { AdjIter(), AdjIter() };
+
+        p += compressed_details::getSkipsNum(degree) * sizeof(compressed_details::Skip);
+        VId first = v + compressed_details::unzigzag(compressed_details::readVarint(p));
+
+        return { AdjIter(p, first, degree), AdjIter() };
+    }
+
+protected:
+    /// \brief Encodes the adjacency lists given by \a getAdj(v, adj) on
+    /// \a threadsNum threads.
+    ///
+    /// Ranges of vertices are encoded into separate buffers concatenated then.
+    template <typename F>
+    void build(F getAdj, unsigned threadsNum)
+    {
+        const size_t n = _vertices.size();
+        threadsNum = par::getThreadsNum(threadsNum);
+        size_t partsNum = std::max<size_t>(1, std::min<size_t>(n, threadsNum * 4));
+
+        std::vector<std::vector<std::uint8_t>> parts(partsNum);
+        _offsets.assign(n + 1, 0);
+        par::parallelFor(partsNum, threadsNum, [&](size_t i, unsigned)
+        {
+            std::vector<VId> adj;
+            for(size_t v = n * i / partsNum; v < n * (i + 1) / partsNum; ++v)
+            {
+                _offsets[v] = parts[i].size();
+                adj.clear();
+                getAdj(static_cast<VId>(v), adj);
+                compressed_details::encodeList(static_cast<VId>(v), adj, parts[i]);
+            }
+        }, 1);
+
+        size_t total = 0;
+        for(const std::vector<std::uint8_t>& part : parts)
+            total += part.size();
+        _data.reserve(total);
+        for(size_t i = 0; i < partsNum; ++i)
+        {
+            for(size_t v = n * i / partsNum; v < n * (i + 1) / partsNum; ++v)
+                _offsets[v] += _data.size();
+            _data.insert(_data.end(), parts[i].begin(), parts[i].end());
+            std::vector<std::uint8_t>().swap(parts[i]);
+        }
+        _offsets[n] = _data.size();
+    }
+
+protected:
+    std::vector<Vertex> _vertices;      ///< Original vertices by dense ids.
+    std::vector<size_t> _offsets;       ///< Beginnings of encoded lists, n + 1.
+    std::vector<std::uint8_t> _data;    ///< Concatenated encoded lists.
+    size_t _edgesNum;                   ///< Number of undirected edges.
+    std::vector<VId> _index;            ///< Dense ids by vertices, if reordered.
+}; // class CompressedUGraph
+
+
+#endif // COMPRESSED_UGRAPH_HPP
@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for frozen (CSR) labeled
+///             undirected graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CSR_LBL_UGRAPH_HPP
+#define CSR_LBL_UGRAPH_HPP
+
+#include <vector>
+
+#include "csr_ugraph.hpp"
+#include "lbl_ugraph.hpp"
+
+
+/*! ****************************************************************************
+ *  \brief The CsrEdgeLblUGraph class represents a read-only snapshot of an
+ *  EdgeLblUGraph in the CSR form.
+ *
+ *  Edge labels are stored in an array parallel to the adjacency array, so
+ *  the label of the i-th neighbour of a vertex v is getAdjLabels(v)[i]. Every
+ *  edge has its label stored twice, once per direction.
+ *
+ *  \tparam Vertex represents a type for vertices. See requirements for UGraph.
+ *  \tparam EdgeLbl represents a type for edge labeling.
+ ******************************************************************************/
+template <typename Vertex, typename EdgeLbl>
+class CsrEdgeLblUGraph
+        : public CsrUGraph<Vertex>
+{
+public:
+    // Aliases
+    typedef CsrUGraph<Vertex> Base;
+    typedef typename Base::VId VId;
+
+    /// Type of edge labels.
+    typedef EdgeLbl Label;
+
+    /// Iterator type for labels of adjacent edges.
+    typedef const EdgeLbl* AdjLblIter;
+
+public:
+    /// Creates an empty graph.
+    CsrEdgeLblUGraph()
+    {
+    }
+
+    /// \brief Makes a CSR snapshot of the given graph \a g.
+    ///
+    /// Edges that have no label in \a g are labeled with \a dfltLbl.
+    explicit CsrEdgeLblUGraph(const EdgeLblUGraph<Vertex, EdgeLbl>& g,
+                              EdgeLbl dfltLbl = EdgeLbl())
+        : Base(g)
+    {
+        _labels.resize(Base::_adj.size(), dfltLbl);
+        for(VId v = 0; v < Base::getVerticesNum(); ++v)
+        {
+            typename Base::AdjIterPair adj = Base::getAdjVertices(v);
+            EdgeLbl* lbls = _labels.data() + Base::getAdjOffset(v);
+            for(typename Base::AdjIter it = adj.first; it != adj.second; ++it, ++lbls)
+            {
+                EdgeLbl lbl;
+                if(g.getLabel(Base::getVertex(v), Base::getVertex(*it), lbl))
+                    *lbls = lbl;
+            }
+        }
+    }
+
+    /// \brief Makes a copy of the graph \a g with the dense ids permuted by
+    /// \a newIds on \a threadsNum threads; see CsrUGraph.
+    CsrEdgeLblUGraph(const CsrEdgeLblUGraph& g, const std::vector<VId>& newIds,
+                     unsigned threadsNum = 0)
+        : CsrEdgeLblUGraph(g, newIds, threadsNum, std::vector<size_t>())
+    {
+    }
+
+protected:
+    /// The same, with a buffer \a srcPos for the positions of the labels.
+    CsrEdgeLblUGraph(const CsrEdgeLblUGraph& g, const std::vector<VId>& newIds,
+                     unsigned threadsNum, std::vector<size_t>&& srcPos)
+        : Base(g, newIds, &srcPos, threadsNum)
+    {
+        _labels.reserve(srcPos.size());
+        for(size_t pos : srcPos)
+            _labels.push_back(g._labels[pos]);
+    }
+
+public:
+    /// Returns the labels of the edges adjacent to the vertex \a v, ordered
+    /// the same way as getAdjVertices(v).
+    AdjLblIter getAdjLabels(VId v) const
+    {
+        return _labels.data() + Base::getAdjOffset(v);
+    }
+
+protected:
+    std::vector<EdgeLbl> _labels;   ///< Labels parallel to the adjacency array.
+}; // class CsrEdgeLblUGraph
+
+
+#endif // CSR_LBL_UGRAPH_HPP
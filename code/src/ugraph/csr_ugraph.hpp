@@ -0,0 +1,303 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains declarations of the types for frozen (CSR) undirected
+///             graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CSR_UGRAPH_HPP
+#define CSR_UGRAPH_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "par_utils.hpp"
+#include "ugraph.hpp"
+
+
+namespace csr_details {
+
+/// \brief Finds the dense id of the vertex \a v among the \a n vertices
+/// \a vertices ordered by dense ids, in O(log n).
+///
+/// The vertices are sorted, unless there is \a index: the dense ids ordered
+/// by their vertices, for reordered graphs.
+template <typename Vertex, typename VId>
+bool findVId(const Vertex* vertices, size_t n, const VId* index, const Vertex& v, VId& id)
+{
+    if(!index)
+    {
+        const Vertex* it = std::lower_bound(vertices, vertices + n, v);
+        if(it == vertices + n || v < *it)
+            return false;
+
+        id = static_cast<VId>(it - vertices);
+        return true;
+    }
+
+    const VId* it = std::lower_bound(index, index + n, v,
+        [vertices](VId a, const Vertex& b) { return vertices[a] < b; });
+    if(it == index + n || v < vertices[*it])
+        return false;
+
+    id = *it;
+    return true;
+}
+
+/// Returns the inverse of the permutation \a newIds of \a n dense ids;
+/// throws std::invalid_argument if it is not a permutation.
+inline std::vector<std::uint32_t> invertPermutation(const std::vector<std::uint32_t>& newIds,
+                                                    size_t n)
+{
+    const std::uint32_t none = static_cast<std::uint32_t>(-1);
+    std::vector<std::uint32_t> oldIds(n, none);
+    if(newIds.size() != n)
+        throw std::invalid_argument("Not a permutation of the vertices");
+    for(size_t v = 0; v < n; ++v)
+    {
+        if(newIds[v] >= n || oldIds[newIds[v]] != none)
+            throw std::invalid_argument("Not a permutation of the vertices");
+        oldIds[newIds[v]] = static_cast<std::uint32_t>(v);
+    }
+
+    return oldIds;
+}
+
+} // namespace csr_details
+
+
+/*! ****************************************************************************
+ *  \brief The CsrUGraph class represents a read-only snapshot of a UGraph in
+ *  the compressed sparse row (CSR) form.
+ *
+ *  Vertices are enumerated by dense ids 0..n-1 following the order of the
+ *  vertices in the original graph, or in any other order given by
+ *  a permutation (see ugraph_reorder.hpp). The neighbours of every vertex are stored
+ *  in one contiguous sorted array, so the heavy algorithms can scan them
+ *  without walking the multimap. A self-loop is stored once in the
+ *  neighbours list of its vertex.
+ *
+ *  This class (and any other type providing the same methods) is the graph
+ *  concept expected by the parallel algorithms of the library.
+ *
+ *  \tparam Vertex represents a type for vertices. See requirements for UGraph.
+ ******************************************************************************/
+template <typename Vertex>
+class CsrUGraph {
+public:
+    // type definitions
+
+    /// Dense vertex id.
+    typedef std::uint32_t VId;
+
+    /// Iterator type for adjacent vertices.
+    typedef const VId* AdjIter;
+
+    /// Pair of adjacent vertices iterators.
+    typedef std::pair<AdjIter, AdjIter> AdjIterPair;
+
+public:
+    /// Creates an empty graph.
+    CsrUGraph()
+        : _offsets(1, 0), _edgesNum(0)
+    {
+    }
+
+    /// Makes a CSR snapshot of the given graph \a g.
+    explicit CsrUGraph(const UGraph<Vertex>& g)
+        : _edgesNum(g.getEdgesNum())
+    {
+        typename UGraph<Vertex>::VertexIterPair vs = g.getVertices();
+        _vertices.assign(vs.first, vs.second);
+
+        _offsets.reserve(_vertices.size() + 1);
+        _offsets.push_back(0);
+        _adj.reserve(g.getEdgesNum() * 2);
+        for(const Vertex& v : _vertices)
+        {
+            size_t beg = _adj.size();
+            typename UGraph<Vertex>::AdjListCIterPair es = g.getAdjEdges(v);
+            for(auto it = es.first; it != es.second; ++it)
+            {
+                VId d;
+                getVId(it->second, d);
+                _adj.push_back(d);
+            }
+
+            // a self-loop has two entries in the multimap
+            std::sort(_adj.begin() + beg, _adj.end());
+            _adj.erase(std::unique(_adj.begin() + beg, _adj.end()), _adj.end());
+            _offsets.push_back(_adj.size());
+        }
+    }
+
+    /// \brief Makes a copy of the graph \a g with the dense ids permuted by
+    /// \a newIds on \a threadsNum threads.
+    ///
+    /// The vertex of the dense id v in \a g gets the dense id newIds[v];
+    /// getVertex() and getVId() keep mapping the new ids to the original
+    /// vertices. Throws std::invalid_argument if \a newIds is not a
+    /// permutation of the dense ids.
+    CsrUGraph(const CsrUGraph& g, const std::vector<VId>& newIds, unsigned threadsNum = 0)
+        : CsrUGraph(g, newIds, nullptr, threadsNum)
+    {
+    }
+
+protected:
+    /// The same; also stores the position in the adjacency array of \a g of
+    /// every entry of the adjacency array to \a srcPos, if any.
+    CsrUGraph(const CsrUGraph& g, const std::vector<VId>& newIds, std::vector<size_t>* srcPos,
+              unsigned threadsNum)
+        : _edgesNum(g._edgesNum)
+    {
+        const size_t n = g.getVerticesNum();
+        std::vector<VId> oldIds = csr_details::invertPermutation(newIds, n);
+
+        _vertices.reserve(n);
+        _offsets.reserve(n + 1);
+        _offsets.push_back(0);
+        for(VId u = 0; u < n; ++u)
+        {
+            _vertices.push_back(g._vertices[oldIds[u]]);
+            _offsets.push_back(_offsets.back() + g.getDegree(oldIds[u]));
+        }
+
+        _adj.resize(g._adj.size());
+        if(srcPos)
+            srcPos->resize(_adj.size());
+        par::parallelFor(n, threadsNum, [&](size_t u, unsigned)
+        {
+            size_t from = g._offsets[oldIds[u]], to = g._offsets[oldIds[u] + 1];
+            VId* adj = _adj.data() + _offsets[u];
+            if(!srcPos)
+            {
+                for(size_t i = from; i < to; ++i)
+                    *adj++ = newIds[g._adj[i]];
+                std::sort(_adj.data() + _offsets[u], adj);
+                return;
+            }
+
+            size_t* pos = srcPos->data() + _offsets[u];
+            for(size_t i = from; i < to; ++i)
+                pos[i - from] = i;
+            std::sort(pos, pos + (to - from), [&](size_t a, size_t b)
+            {
+                return newIds[g._adj[a]] < newIds[g._adj[b]];
+            });
+            for(size_t i = 0; i < to - from; ++i)
+                adj[i] = newIds[g._adj[pos[i]]];
+        }, 256);
+
+        // dense ids by vertices: by the ids of g or by its index
+        bool identity = true;
+        _index.resize(n);
+        for(size_t i = 0; i < n; ++i)
+        {
+            _index[i] = newIds[g._index.empty() ? i : g._index[i]];
+            identity = identity && _index[i] == i;
+        }
+        if(identity)
+            std::vector<VId>().swap(_index);
+    }
+
+public:
+    // setters/getters
+    size_t getVerticesNum() const { return _vertices.size(); }
+    size_t getEdgesNum() const { return _edgesNum; }
+
+    /// Returns the number of the neighbours of the vertex \a v in O(1); the
+    /// same as UGraph::getDegree(), i.e. a self-loop counts once.
+    size_t getDegree(VId v) const { return _offsets[v + 1] - _offsets[v]; }
+
+    /// Collects the statistics of vertex degrees in a single pass.
+    DegreeStats getDegreeStats() const
+    {
+        DegreeStats st;
+        for(VId v = 0; v < getVerticesNum(); ++v)
+            st.addDegree(getDegree(v));
+        st.finish(getVerticesNum());
+
+        return st;
+    }
+
+    /// Checks whether the vertex \a v has a self-loop, in O(log(deg v)).
+    bool hasSelfLoop(VId v) const
+    {
+        AdjIterPair adj = getAdjVertices(v);
+        return std::binary_search(adj.first, adj.second, v);
+    }
+
+    /// Returns the position of the first neighbour of the vertex \a v in the
+    /// global adjacency array; can be used for per-edge arrays.
+    size_t getAdjOffset(VId v) const { return _offsets[v]; }
+
+    /// Returns the original vertex by its dense id \a v.
+    const Vertex& getVertex(VId v) const { return _vertices[v]; }
+
+    /// For a given vertex \a v tries to find its dense id.
+    ///
+    /// \return true if the vertex exists and \a id is assigned to its dense
+    /// id; false otherwise.
+    bool getVId(const Vertex& v, VId& id) const
+    {
+        return csr_details::findVId(_vertices.data(), _vertices.size(),
+                                    _index.empty() ? nullptr : _index.data(), v, id);
+    }
+
+    /// Returns the dense ids ordered by their vertices if the graph is
+    /// reordered, or an empty vector if dense ids follow the vertices.
+    const std::vector<VId>& getVertexIndex() const { return _index; }
+
+    /// Return a sorted range of dense ids of the neighbours of the vertex \a v.
+    AdjIterPair getAdjVertices(VId v) const
+    {
+        const VId* base = _adj.data();
+        return { base + _offsets[v], base + _offsets[v + 1] };
+    }
+
+protected:
+    /// \brief Sets the structure of the graph made by a derived class; the
+    /// vertices are indexed if they are not sorted.
+    void assign(std::vector<Vertex>&& vertices, std::vector<size_t>&& offsets,
+                std::vector<VId>&& adj, size_t edgesNum)
+    {
+        _vertices = std::move(vertices);
+        _offsets = std::move(offsets);
+        _adj = std::move(adj);
+        _edgesNum = edgesNum;
+
+        _index.clear();
+        if(!std::is_sorted(_vertices.begin(), _vertices.end()))
+        {
+            _index.resize(_vertices.size());
+            for(size_t i = 0; i < _index.size(); ++i)
+                _index[i] = static_cast<VId>(i);
+            std::sort(_index.begin(), _index.end(), [this](VId a, VId b)
+            {
+                return _vertices[a] < _vertices[b];
+            });
+        }
+    }
+
+protected:
+    std::vector<Vertex> _vertices;  ///< Original vertices by dense ids.
+    std::vector<size_t> _offsets;   ///< Beginnings of adjacency lists, n + 1.
+    std::vector<VId> _adj;          ///< Concatenated adjacency lists.
+    size_t _edgesNum;               ///< Number of undirected edges.
+    std::vector<VId> _index;        ///< Dense ids by vertices, if reordered.
+}; // class CsrUGraph
+
+
+#endif // CSR_UGRAPH_HPP
@@ -18,7 +18,9 @@
 
 #include "ugraph.hpp"
 
+#include <algorithm>
 #include <map>
+#include <vector>
 
 /*! ****************************************************************************
  *  \brief The EdgeLblUGraph class represents a undirected graph with labels on
@@ -42,6 +44,9 @@ public:
     typedef std::map<typename Base::Edge, EdgeLbl> EdgeLabeling;
     typedef typename EdgeLabeling::const_iterator EdgeLabelingCIter;
 
+    /// An edge with a label, for adding edges by batches.
+    typedef std::pair<Edge, EdgeLbl> LblEdge;
+
 public:
     // Graph structure modifying methods.
 
@@ -58,6 +63,31 @@ public:
         return e;
     }
 
+    /// \brief Adds a batch of labeled edges, as addLblEdge() does for each of
+    /// them.
+    ///
+    /// If an edge repeats, it gets the first label given for it, which is
+    /// kept if the edge is already labeled. See also UGraph::addEdges().
+    void addLblEdges(std::vector<LblEdge> edges)
+    {
+        for(LblEdge& e : edges)
+            e.first = Base::makeNormalizedEdge(e.first.first, e.first.second);
+        std::stable_sort(edges.begin(), edges.end(),
+            [](const LblEdge& a, const LblEdge& b) { return a.first < b.first; });
+        edges.erase(std::unique(edges.begin(), edges.end(),
+            [](const LblEdge& a, const LblEdge& b) { return a.first == b.first; }),
+            edges.end());
+
+        std::vector<Edge> plain;
+        plain.reserve(edges.size());
+        for(const LblEdge& e : edges)
+            plain.push_back(e.first);
+        Base::addSortedEdges(plain);
+
+        for(LblEdge& e : edges)
+            _edgeLabeling.emplace_hint(_edgeLabeling.end(), e.first, std::move(e.second));
+    }
+
     /// For a given edge \a e tries to find an associated label and returns it
     /// if so.
     ///
@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains simple helpers for running loops on multiple threads.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PAR_UTILS_HPP
+#define PAR_UTILS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace par {
+
+/// Returns the number of threads to be used: \a threadsNum itself if it is
+/// non-zero, or the number of hardware threads otherwise.
+inline unsigned getThreadsNum(unsigned threadsNum = 0)
+{
+    if(threadsNum)
+        return threadsNum;
+
+    unsigned hw = std::thread::hardware_concurrency();
+    return hw ? hw : 1;
+}
+
+/// \brief Runs \a f on \a threadsNum threads and waits for all of them.
+///
+/// \a f is called as f(threadId), where threadId is in [0, threadsNum). The
+/// calling thread runs as thread 0. The first exception thrown by any of the
+/// threads is rethrown after all the threads are joined.
+template <typename F>
+void runThreads(unsigned threadsNum, F f)
+{
+    threadsNum = getThreadsNum(threadsNum);
+    if(threadsNum == 1)
+    {
+        f(0u);
+        return;
+    }
+
+    std::exception_ptr err;
+    std::mutex errMutex;
+    auto guarded = [&](unsigned tid)
+    {
+        try
+        {
+            f(tid);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(errMutex);
+            if(!err)
+                err = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadsNum - 1);
+    for(unsigned t = 1; t < threadsNum; ++t)
+        threads.emplace_back(guarded, t);
+    guarded(0);
+
+    for(std::thread& th : threads)
+        th.join();
+
+    if(err)
+        std::rethrow_exception(err);
+}
+
+/// \brief Calls f(i, threadId) for every i in [0, n).
+///
+/// Indices are handed out dynamically in chunks of \a grain elements, so
+/// uneven work per index (e.g. vertex degrees) is balanced automatically.
+/// Small ranges are processed by the calling thread only.
+template <typename F>
+void parallelFor(size_t n, unsigned threadsNum, F f, size_t grain = 1024)
+{
+    if(n == 0)
+        return;
+
+    grain = std::max<size_t>(grain, 1);
+    threadsNum = getThreadsNum(threadsNum);
+    size_t chunks = (n + grain - 1) / grain;
+    if(chunks < threadsNum)
+        threadsNum = static_cast<unsigned>(chunks);
+
+    std::atomic<size_t> next(0);
+    runThreads(threadsNum, [&](unsigned tid)
+    {
+        for(;;)
+        {
+            size_t from = next.fetch_add(grain, std::memory_order_relaxed);
+            if(from >= n)
+                break;
+
+            size_t to = std::min(n, from + grain);
+            for(size_t i = from; i < to; ++i)
+                f(i, tid);
+        }
+    });
+}
+
+/// Atomically lowers the value of \a a to \a v if \a v is less than the
+/// current value. Returns true if the value has been changed.
+template <typename T>
+bool atomicMin(std::atomic<T>& a, T v)
+{
+    T cur = a.load(std::memory_order_relaxed);
+    while(v < cur)
+    {
+        if(a.compare_exchange_weak(cur, v, std::memory_order_relaxed))
+            return true;
+    }
+
+    return false;
+}
+
+} // namespace par
+
+
+#endif // PAR_UTILS_HPP
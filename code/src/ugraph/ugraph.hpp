@@ -18,11 +18,50 @@
 #define UGRAPH_HPP
 
 
+#include <algorithm>
 #include <set>
 #include <map>
+#include <vector>
 //#include <cstddef> // size_t
 
 
+/// Summary of vertex degrees of a graph.
+struct DegreeStats {
+    size_t minDegree;                   ///< 0 for an empty graph.
+    size_t maxDegree;                   ///< 0 for an empty graph.
+    double meanDegree;                  ///< 0 for an empty graph.
+
+    /// histogram[d] is the number of vertices of degree d; has maxDegree + 1
+    /// elements for a non-empty graph.
+    std::vector<size_t> histogram;
+
+    DegreeStats()
+        : minDegree(0), maxDegree(0), meanDegree(0)
+    {
+    }
+
+    /// Accounts one more vertex of degree \a d.
+    void addDegree(size_t d)
+    {
+        if(histogram.empty() || d < minDegree)
+            minDegree = d;
+        if(histogram.empty() || d > maxDegree)
+            maxDegree = d;
+        if(d >= histogram.size())
+            histogram.resize(d + 1, 0);
+        ++histogram[d];
+        meanDegree += static_cast<double>(d);
+    }
+
+    /// Turns the sum of degrees into the mean for \a verticesNum vertices.
+    void finish(size_t verticesNum)
+    {
+        if(verticesNum)
+            meanDegree /= static_cast<double>(verticesNum);
+    }
+};
+
+
 
 /*! ****************************************************************************
  *  \brief The UGraph class represents a undirected graph.
@@ -60,6 +99,9 @@ public:
     typedef typename AdjList::const_iterator AdjListCIter;
     typedef std::pair<AdjListCIter, AdjListCIter> AdjListCIterPair;
 
+    /// Degrees of vertices.
+    typedef std::map<Vertex, size_t> DegreeMap;
+
 
     /// \brief Custom definition of Edge Iterators.
     ///
@@ -194,6 +236,7 @@ public:
     Vertex addVertex(Vertex v)
     {
         _vertices.insert(v);
+        _degrees.insert({v, 0});            // keeps the degree if exists
         return v;
     }
 
@@ -213,6 +256,11 @@ public:
             // add edges vertices too
             addVertex(s);
             addVertex(d);
+
+            // a self-loop is a single incident edge
+            ++_degrees[s];
+            if(s != d)
+                ++_degrees[d];
         }
         //Edge e(s, d);
         Edge e = makeNormalizedEdge(s, d);
@@ -220,6 +268,36 @@ public:
         return e;
     }
 
+    /// \brief Adds a batch of vertices, as addVertex() does for each of them.
+    ///
+    /// The batch is sorted and deduplicated first, so the vertices are
+    /// inserted at known positions.
+    void addVertices(std::vector<Vertex> vs)
+    {
+        std::sort(vs.begin(), vs.end());
+        vs.erase(std::unique(vs.begin(), vs.end()), vs.end());
+        for(const Vertex& v : vs)
+        {
+            _vertices.emplace_hint(_vertices.end(), v);
+            _degrees.emplace_hint(_degrees.end(), v, 0);
+        }
+    }
+
+    /// \brief Adds a batch of edges, as addEdge() does for each of them.
+    ///
+    /// The edges need not be normalized and may repeat. Degrees are updated
+    /// along with the edges. The batch is sorted first, so the edges of a
+    /// graph that has none are inserted at known positions instead of being
+    /// searched for one by one.
+    void addEdges(std::vector<Edge> edges)
+    {
+        for(Edge& e : edges)
+            e = makeNormalizedEdge(e.first, e.second);
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+        addSortedEdges(edges);
+    }
+
     /// Method determines whether an edge {s, d} exists in this graph.
     ///
     /// \return true if the edge exists, false otherwise.
@@ -251,6 +329,29 @@ public:
     size_t getVerticesNum() const { return _vertices.size(); }
     size_t getEdgesNum() const { return _edges.size() / 2; }
 
+    /// \brief Returns the degree of the vertex \a v, or 0 if there is no such
+    /// vertex.
+    ///
+    /// The degree is the number of edges incident to \a v, so a self-loop
+    /// counts once. Degrees are maintained along with the edges, so the call
+    /// costs a single lookup by the vertex and does not depend on the degree.
+    size_t getDegree(Vertex v) const
+    {
+        typename DegreeMap::const_iterator it = _degrees.find(v);
+        return it == _degrees.end() ? 0 : it->second;
+    }
+
+    /// Collects the statistics of vertex degrees in a single pass.
+    DegreeStats getDegreeStats() const
+    {
+        DegreeStats st;
+        for(const typename DegreeMap::value_type& vd : _degrees)
+            st.addDegree(vd.second);
+        st.finish(_degrees.size());
+
+        return st;
+    }
+
 
     /// Provides a collection of vertices as a semirange (pair of iterators).
     VertexIterPair getVertices() const
@@ -274,9 +375,48 @@ public:
     }
 
 
+protected:
+    /// Adds the normalized, sorted and unique \a edges not existing yet.
+    void addSortedEdges(const std::vector<Edge>& edges)
+    {
+        // both halves of each edge, ordered by the first vertex; the two
+        // halves of a self-loop stay adjacent, as the edge iterator expects
+        bool fresh = _edges.empty();
+        std::vector<Edge> halves;
+        halves.reserve(edges.size() * 2);
+        for(const Edge& e : edges)
+        {
+            if(!fresh && isEdgeExists(e.first, e.second))
+                continue;
+            halves.push_back(e);
+            halves.push_back({e.second, e.first});
+        }
+        std::sort(halves.begin(), halves.end());
+
+        for(size_t i = 0; i < halves.size(); )
+        {
+            const Vertex& v = halves[i].first;
+            size_t degree = 0;
+            for(; i < halves.size() && !(v < halves[i].first); ++i)
+            {
+                _edges.emplace_hint(_edges.end(), halves[i]);
+                if(!(halves[i].second == v))
+                    ++degree;
+                else if(++i < halves.size())        // the twin of a self-loop
+                {
+                    _edges.emplace_hint(_edges.end(), halves[i]);
+                    ++degree;
+                }
+            }
+            _vertices.emplace_hint(_vertices.end(), v);
+            _degrees.emplace_hint(_degrees.end(), v, 0)->second += degree;
+        }
+    }
+
 protected:
     VerticesSet _vertices;      ///< Set of vertices.
     AdjList _edges;             ///< Adjacency list for representing edges.
+    DegreeMap _degrees;         ///< Maintained degrees of vertices.
 }; // class UGraph
 
 
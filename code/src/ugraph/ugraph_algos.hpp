@@ -17,9 +17,17 @@
 #ifndef UGRAPH_ALGOS_HPP
 #define UGRAPH_ALGOS_HPP
 
+#include <atomic>
+#include <cstdint>
+#include <limits>
 #include <set>
+#include <tuple>
+#include <vector>
 
+#include "bit_utils.hpp"
+#include "csr_lbl_ugraph.hpp"
 #include "lbl_ugraph.hpp"
+#include "par_utils.hpp"
 
 
 /// Finds a MST for the given graph \a g using Prim's algorithm.
@@ -45,4 +53,249 @@ std::set<typename EdgeLblUGraph<Vertex, EdgeLbl>::Edge>
 }
 
 
+/// \brief Finds a maximal independent set of the graph \a g using Luby's
+/// algorithm with random priorities on \a threadsNum threads.
+///
+/// In every round, undecided vertices whose priorities are higher than the
+/// ones of all their undecided neighbours join the set, and their neighbours
+/// leave the game. Priorities are derived from \a seed, so the result does
+/// not depend on the number of threads. A vertex with a self-loop is never
+/// taken.
+///
+/// \return sorted dense ids of the vertices of the set.
+template <typename TGraph>
+std::vector<typename TGraph::VId>
+    findMaximalIndependentSet(const TGraph& g, unsigned threadsNum = 0,
+                              unsigned seed = 5489u)
+{
+    typedef typename TGraph::VId VId;
+    enum State : unsigned char { undecided, in, out };
+
+    const size_t n = g.getVerticesNum();
+    threadsNum = par::getThreadsNum(threadsNum);
+
+    auto prio = [seed](VId v) { return bits::mix64(seed ^ bits::mix64(v)); };
+    auto higher = [&prio](VId a, VId b)
+    {
+        std::uint64_t pa = prio(a), pb = prio(b);
+        return pa > pb || (pa == pb && a > b);
+    };
+
+    std::vector<std::atomic<unsigned char>> state(n);
+    std::vector<VId> active;
+    for(VId v = 0; v < n; ++v)
+    {
+        bool loop = g.hasSelfLoop(v);
+        state[v].store(loop ? out : undecided, std::memory_order_relaxed);
+        if(!loop)
+            active.push_back(v);
+    }
+
+    std::vector<std::vector<VId>> localSel(threadsNum);
+    std::vector<VId> selected;
+    while(!active.empty())
+    {
+        // local maxima among undecided vertices join the set
+        par::parallelFor(active.size(), threadsNum, [&](size_t i, unsigned tid)
+        {
+            VId v = active[i];
+            if(state[v].load(std::memory_order_relaxed) != undecided)
+                return;
+
+            typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+            for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+                if(state[*it].load(std::memory_order_relaxed) == undecided
+                        && higher(*it, v))
+                    return;
+            localSel[tid].push_back(v);
+        }, 256);
+
+        selected.clear();
+        for(std::vector<VId>& ls : localSel)
+        {
+            selected.insert(selected.end(), ls.begin(), ls.end());
+            ls.clear();
+        }
+
+        // the neighbours of the joined ones leave
+        par::parallelFor(selected.size(), threadsNum, [&](size_t i, unsigned)
+        {
+            VId v = selected[i];
+            state[v].store(in, std::memory_order_relaxed);
+            typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+            for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+                if(*it != v)
+                    state[*it].store(out, std::memory_order_relaxed);
+        }, 256);
+
+        size_t kept = 0;
+        for(VId v : active)
+            if(state[v].load(std::memory_order_relaxed) == undecided)
+                active[kept++] = v;
+        active.resize(kept);
+    }
+
+    std::vector<VId> res;
+    for(VId v = 0; v < n; ++v)
+        if(state[v].load(std::memory_order_relaxed) == in)
+            res.push_back(v);
+
+    return res;
+}
+
+
+/// Result of a matching search.
+template <typename VId>
+struct GraphMatching {
+    /// Mate of every vertex by dense id, or noMate() for unmatched ones.
+    std::vector<VId> mates;
+
+    /// Number of matched edges.
+    size_t edgesNum;
+
+    static VId noMate() { return std::numeric_limits<VId>::max(); }
+};
+
+
+namespace matching_details {
+
+/// \brief Finds a matching of locally dominant edges.
+///
+/// \a key(v, i) gives a comparable key of the i-th edge of the vertex v, the
+/// same from both endpoints. In every round, every unmatched vertex points
+/// to its best edge to an unmatched neighbour, and mutual pointers are
+/// matched. The globally best remaining edge is always mutual, so every round
+/// makes progress, and the result equals the sequential greedy matching in
+/// the key order.
+template <typename TGraph, typename KeyFn>
+GraphMatching<typename TGraph::VId>
+    findLocallyDominantMatching(const TGraph& g, unsigned threadsNum, KeyFn key)
+{
+    typedef typename TGraph::VId VId;
+    typedef GraphMatching<VId> Result;
+
+    const size_t n = g.getVerticesNum();
+    threadsNum = par::getThreadsNum(threadsNum);
+
+    Result res;
+    res.mates.assign(n, Result::noMate());
+    res.edgesNum = 0;
+
+    std::vector<VId> cand(n, Result::noMate());
+    std::vector<VId> active(n);
+    for(size_t i = 0; i < n; ++i)
+        active[i] = static_cast<VId>(i);
+
+    while(!active.empty())
+    {
+        // every vertex points to its best available edge
+        par::parallelFor(active.size(), threadsNum, [&](size_t i, unsigned)
+        {
+            VId v = active[i];
+            VId best = Result::noMate();
+            size_t bestPos = 0;
+            typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+            for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+            {
+                VId u = *it;
+                if(u == v || res.mates[u] != Result::noMate())
+                    continue;
+
+                size_t pos = static_cast<size_t>(it - adj.first);
+                if(best == Result::noMate() || key(v, bestPos) < key(v, pos))
+                {
+                    best = u;
+                    bestPos = pos;
+                }
+            }
+            cand[v] = best;
+        }, 256);
+
+        // mutual pointers are matched by the smaller endpoint
+        par::parallelFor(active.size(), threadsNum, [&](size_t i, unsigned)
+        {
+            VId v = active[i];
+            VId u = cand[v];
+            if(u != Result::noMate() && v < u && cand[u] == v)
+            {
+                res.mates[v] = u;
+                res.mates[u] = v;
+            }
+        }, 1024);
+
+        size_t kept = 0;
+        for(VId v : active)
+        {
+            if(res.mates[v] != Result::noMate())
+                ++res.edgesNum;
+            else if(cand[v] != Result::noMate())
+                active[kept++] = v;             // still has free neighbours
+        }
+        active.resize(kept);
+    }
+    res.edgesNum /= 2;
+
+    return res;
+}
+
+/// Returns a seeded random key of the edge {a, b}, symmetric in a and b.
+template <typename VId>
+std::pair<std::uint64_t, std::uint64_t> getRandomEdgeKey(VId a, VId b,
+                                                         unsigned seed)
+{
+    std::uint64_t lo = std::min(a, b), hi = std::max(a, b);
+    std::uint64_t id = (hi << 32) | lo;
+    return { bits::mix64(seed ^ bits::mix64(id)), id };
+}
+
+} // namespace matching_details
+
+
+/// \brief Finds a maximal matching of the graph \a g on \a threadsNum
+/// threads.
+///
+/// Edges get random priorities derived from \a seed, and locally dominant
+/// ones are matched round by round, so the result does not depend on the
+/// number of threads. Self-loops are ignored.
+template <typename TGraph>
+GraphMatching<typename TGraph::VId>
+    findMaximalMatching(const TGraph& g, unsigned threadsNum = 0,
+                        unsigned seed = 5489u)
+{
+    typedef typename TGraph::VId VId;
+
+    return matching_details::findLocallyDominantMatching(g, threadsNum,
+                [&g, seed](VId v, size_t i)
+    {
+        return matching_details::getRandomEdgeKey(v, g.getAdjVertices(v).first[i], seed);
+    });
+}
+
+
+/// \brief Finds a 1/2-approximate maximum weight matching of the graph \a g
+/// with edge labels as weights, on \a threadsNum threads.
+///
+/// Heavier edges win; equal weights are ordered randomly by \a seed. The
+/// result equals the greedy matching taking edges in the order of decreasing
+/// weight, which is at least half as heavy as the maximum one.
+///
+/// \tparam TGraph is a labeled graph type with dense ids, such as
+/// CsrEdgeLblUGraph.
+template <typename TGraph>
+GraphMatching<typename TGraph::VId>
+    findGreedyWeightedMatching(const TGraph& g, unsigned threadsNum = 0,
+                               unsigned seed = 5489u)
+{
+    typedef typename TGraph::VId VId;
+
+    return matching_details::findLocallyDominantMatching(g, threadsNum,
+                [&g, seed](VId v, size_t i)
+    {
+        std::pair<std::uint64_t, std::uint64_t> rk =
+                matching_details::getRandomEdgeKey(v, g.getAdjVertices(v).first[i], seed);
+        return std::make_tuple(g.getAdjLabels(v)[i], rk.first, rk.second);
+    });
+}
+
+
 #endif // UGRAPH_ALGOS_HPP
@@ -0,0 +1,553 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains implementations of the ALT (A*, landmarks, triangle
+///             inequality) shortest path queries.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UGRAPH_ALT_HPP
+#define UGRAPH_ALT_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../grio/mmap_file.hpp"
+#include "par_utils.hpp"
+#include "ugraph_paths.hpp"
+
+
+/// Strategies of landmark selection.
+enum class LandmarkSelection {
+    random,         ///< Random distinct vertices.
+    farthest,       ///< Every next one is the farthest from the chosen ones.
+    avoid           ///< Leaves of the shortest path tree badly covered so far.
+};
+
+
+/*! ****************************************************************************
+ *  \brief The LandmarkTables class represents distances from a few landmark
+ *  vertices to all the vertices of a graph, used as lower bounds of
+ *  distances by the triangle inequality.
+ *
+ *  The distances are kept in a single flat array, one row of n values per
+ *  landmark. The tables can be saved to a binary file and then mapped to
+ *  memory by any number of processes, sharing the same physical pages.
+ *
+ *  \tparam Dist represents a trivially copyable type of edge lengths.
+ ******************************************************************************/
+template <typename Dist>
+class LandmarkTables {
+public:
+    // type definitions
+
+    /// Dense vertex id.
+    typedef std::uint32_t VId;
+
+    static Dist infinity() { return std::numeric_limits<Dist>::max(); }
+
+    static_assert(std::is_trivially_copyable<Dist>::value,
+                  "Distances must be trivially copyable to be mapped");
+
+public:
+    /// Creates empty tables.
+    LandmarkTables()
+        : _verticesNum(0), _mappedDists(nullptr)
+    {
+    }
+
+    /// \brief Selects \a landmarksNum landmarks of the graph \a g with edge
+    /// labels as lengths by the strategy \a sel and computes their tables.
+    ///
+    /// With random selection all the rows are computed in parallel on
+    /// \a threadsNum threads. The other strategies need the rows computed so
+    /// far to choose the next landmark, so they compute rows one by one and
+    /// parallelize the scans over vertices only. \a seed drives all random
+    /// choices.
+    ///
+    /// \tparam TGraph is a labeled graph type with dense ids, such as
+    /// CsrEdgeLblUGraph.
+    template <typename TGraph>
+    LandmarkTables(const TGraph& g, size_t landmarksNum,
+                   LandmarkSelection sel = LandmarkSelection::farthest,
+                   unsigned threadsNum = 0, unsigned seed = 5489u)
+        : _verticesNum(g.getVerticesNum()), _mappedDists(nullptr)
+    {
+        static_assert(std::is_same<typename TGraph::Label, Dist>::value,
+                      "Distances must be of the type of graph labels");
+
+        const size_t n = _verticesNum;
+        const size_t k = std::min(landmarksNum, n);
+        threadsNum = par::getThreadsNum(threadsNum);
+        _own.resize(k * n);
+        std::mt19937 rnd(seed);
+
+        if(sel == LandmarkSelection::random)
+        {
+            std::vector<VId> all(n);
+            for(size_t i = 0; i < n; ++i)
+                all[i] = static_cast<VId>(i);
+            for(size_t i = 0; i < k; ++i)
+                std::swap(all[i], all[i + rnd() % (n - i)]);
+            _landmarks.assign(all.begin(), all.begin() + k);
+
+            par::parallelFor(k, threadsNum, [&](size_t i, unsigned)
+            {
+                computeRow(g, i);
+            }, 1);
+            return;
+        }
+
+        std::vector<bool> chosen(n, false);
+        for(size_t i = 0; i < k; ++i)
+        {
+            VId lm = (sel == LandmarkSelection::farthest)
+                    ? selectFarthest(g, chosen, threadsNum, rnd)
+                    : selectAvoid(g, chosen, threadsNum, rnd);
+            chosen[lm] = true;
+            _landmarks.push_back(lm);
+            computeRow(g, i);
+        }
+    }
+
+public:
+    size_t getLandmarksNum() const { return _landmarks.size(); }
+    size_t getVerticesNum() const { return _verticesNum; }
+
+    /// Returns the landmark vertices in order of rows.
+    const std::vector<VId>& getLandmarks() const { return _landmarks; }
+
+    /// Returns the row of distances from the \a i-th landmark.
+    const Dist* getRow(size_t i) const { return getTable() + i * _verticesNum; }
+
+    /// Returns the distance from the \a i-th landmark to the vertex \a v.
+    Dist getDistance(size_t i, VId v) const { return getRow(i)[v]; }
+
+    /// \brief Returns a lower bound of the distance between \a s and \a t:
+    /// the greatest |d(L, s) - d(L, t)| over landmarks L.
+    ///
+    /// Returns infinity() if some landmark reaches exactly one of them, so
+    /// they are in different components.
+    Dist getLowerBound(VId s, VId t) const
+    {
+        Dist lb = Dist();
+        for(size_t i = 0; i < getLandmarksNum(); ++i)
+        {
+            const Dist* row = getRow(i);
+            if(!updateBound(lb, row[s], row[t]))
+                return infinity();
+        }
+
+        return lb;
+    }
+
+    /// Raises \a lb to |a - b| if it is less; returns false if exactly one
+    /// of \a a and \a b is infinite.
+    static bool updateBound(Dist& lb, Dist a, Dist b)
+    {
+        if(a == infinity() || b == infinity())
+            return a == b;
+
+        Dist d = (a < b) ? b - a : a - b;
+        if(lb < d)
+            lb = d;
+        return true;
+    }
+
+    /// Returns true if the tables are mapped from a file.
+    bool isMapped() const { return static_cast<bool>(_file); }
+
+    /// Saves the tables to the binary file \a fn to be mapped by map().
+    void save(const std::string& fn) const
+    {
+        std::ofstream out(fn, std::ios::binary);
+        if(!out)
+            throw std::invalid_argument("Can't open file for landmark tables");
+
+        FileHeader h = {FILE_MAGIC, FILE_VERSION, sizeof(Dist), 0,
+                        getLandmarksNum(), _verticesNum};
+        out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+        out.write(reinterpret_cast<const char*>(_landmarks.data()),
+                  static_cast<std::streamsize>(_landmarks.size() * sizeof(VId)));
+        static const char pad[TABLE_ALIGN] = {0};
+        out.write(pad, static_cast<std::streamsize>(
+                      getTableOffset(getLandmarksNum()) - sizeof(h)
+                      - _landmarks.size() * sizeof(VId)));
+        out.write(reinterpret_cast<const char*>(getTable()),
+                  static_cast<std::streamsize>(getLandmarksNum() * _verticesNum
+                                               * sizeof(Dist)));
+        if(!out)
+            throw std::invalid_argument("Can't write landmark tables");
+    }
+
+    /// \brief Maps the tables from the binary file \a fn made by save().
+    ///
+    /// The distances are not copied: they are read from the mapping, which
+    /// lives as long as these tables or any of their copies.
+    void map(const std::string& fn)
+    {
+        std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>(fn);
+        FileHeader h;
+        if(file->getSize() < sizeof(h))
+            throw std::invalid_argument("Not a landmark tables file");
+        std::memcpy(&h, file->getData(), sizeof(h));
+        if(h.magic != FILE_MAGIC || h.version != FILE_VERSION
+                || h.distSize != sizeof(Dist))
+            throw std::invalid_argument("Not a landmark tables file of this type");
+
+        // the counts are bounded by the file size before they are multiplied
+        const std::uint64_t size = file->getSize();
+        bool valid = h.landmarksNum <= size / sizeof(VId)
+                && h.verticesNum <= std::numeric_limits<VId>::max()
+                && getTableOffset(static_cast<size_t>(h.landmarksNum)) <= size;
+        if(valid)
+        {
+            std::uint64_t tableSize = size - getTableOffset(static_cast<size_t>(h.landmarksNum));
+            std::uint64_t rowSize = h.landmarksNum * sizeof(Dist);
+            valid = rowSize ? tableSize % rowSize == 0 && tableSize / rowSize == h.verticesNum
+                            : tableSize == 0;
+        }
+        if(!valid)
+            throw std::invalid_argument("Broken landmark tables file");
+
+        std::vector<VId> landmarks(static_cast<size_t>(h.landmarksNum));
+        std::memcpy(landmarks.data(), file->getData() + sizeof(h),
+                    landmarks.size() * sizeof(VId));
+        for(VId l : landmarks)
+            if(l >= h.verticesNum)
+                throw std::invalid_argument("Broken landmark tables file");
+
+        _landmarks.swap(landmarks);
+        _verticesNum = h.verticesNum;
+        _mappedDists = reinterpret_cast<const Dist*>(
+                    file->getData() + getTableOffset(h.landmarksNum));
+        _own.clear();
+        _file = file;
+    }
+
+protected:
+    /// Header of the binary file.
+    struct FileHeader {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t distSize;
+        std::uint32_t reserved;
+        std::uint64_t landmarksNum;
+        std::uint64_t verticesNum;
+    };
+
+    static const std::uint32_t FILE_MAGIC = 0x4d4c4755;    ///< "UGLM"
+    static const std::uint32_t FILE_VERSION = 1;
+    static const size_t TABLE_ALIGN = 64;
+
+    /// Offset of the distances in the file, aligned for any Dist.
+    static size_t getTableOffset(size_t landmarksNum)
+    {
+        size_t off = sizeof(FileHeader) + landmarksNum * sizeof(VId);
+        return (off + TABLE_ALIGN - 1) / TABLE_ALIGN * TABLE_ALIGN;
+    }
+
+    const Dist* getTable() const { return _file ? _mappedDists : _own.data(); }
+
+    /// Fills the row \a i by Dijkstra's search from the \a i-th landmark.
+    template <typename TGraph>
+    void computeRow(const TGraph& g, size_t i)
+    {
+        std::vector<Dist> dists = findShortestPathsDijkstra(g, _landmarks[i]).dists;
+        std::copy(dists.begin(), dists.end(), _own.begin() + i * _verticesNum);
+    }
+
+    /// Returns the not chosen vertex with the greatest distance to the
+    /// nearest landmark (unreachable ones first); the first landmark is the
+    /// farthest vertex from a random one.
+    template <typename TGraph>
+    VId selectFarthest(const TGraph& g, const std::vector<bool>& chosen,
+                       unsigned threadsNum, std::mt19937& rnd)
+    {
+        std::vector<Dist> nearest;
+        if(_landmarks.empty())
+        {
+            nearest = findShortestPathsDijkstra(g, static_cast<VId>(rnd() % _verticesNum)).dists;
+            for(Dist& d : nearest)              // its component goes first
+                d = (d == infinity()) ? Dist() : d;
+        }
+        else
+        {
+            nearest.assign(_verticesNum, infinity());
+            par::parallelFor(_verticesNum, threadsNum, [&](size_t v, unsigned)
+            {
+                for(size_t i = 0; i < _landmarks.size(); ++i)
+                    nearest[v] = std::min(nearest[v], getDistance(i, static_cast<VId>(v)));
+            }, 1 << 12);
+        }
+
+        VId best = 0;
+        bool found = false;
+        for(VId v = 0; v < _verticesNum; ++v)
+            if(!chosen[v] && (!found || nearest[best] < nearest[v]))
+            {
+                best = v;
+                found = true;
+            }
+
+        return best;
+    }
+
+    /// \brief Selects a landmark by the "avoid" heuristic.
+    ///
+    /// Builds the shortest path tree of a random root, weighs every vertex
+    /// by how much the current landmarks underestimate its distance from the
+    /// root, zeroes the subtrees containing landmarks and descends from the
+    /// root to the heaviest child until a leaf is reached.
+    template <typename TGraph>
+    VId selectAvoid(const TGraph& g, const std::vector<bool>& chosen,
+                    unsigned threadsNum, std::mt19937& rnd)
+    {
+        const size_t n = _verticesNum;
+        VId root = static_cast<VId>(rnd() % n);
+        ShortestPaths<VId, Dist> sp = findShortestPathsDijkstra(g, root);
+
+        // weights: how much the distances from the root are underestimated
+        std::vector<double> sizes(n, 0.0);
+        par::parallelFor(n, threadsNum, [&](size_t v, unsigned)
+        {
+            if(sp.dists[v] == sp.infinity())
+                return;
+            Dist lb = getLowerBound(root, static_cast<VId>(v));
+            sizes[v] = static_cast<double>(sp.dists[v])
+                    - (lb == infinity() ? 0.0 : static_cast<double>(lb));
+        }, 1 << 12);
+
+        // children lists and the tree in BFS order (zero lengths allowed)
+        std::vector<size_t> childOffsets(n + 1, 0);
+        for(size_t v = 0; v < n; ++v)
+            if(sp.preds[v] != sp.noPred())
+                ++childOffsets[sp.preds[v] + 1];
+        for(size_t v = 0; v < n; ++v)
+            childOffsets[v + 1] += childOffsets[v];
+        std::vector<VId> children(childOffsets[n]);
+        std::vector<size_t> pos(childOffsets.begin(), childOffsets.end() - 1);
+        for(size_t v = 0; v < n; ++v)
+            if(sp.preds[v] != sp.noPred())
+                children[pos[sp.preds[v]]++] = static_cast<VId>(v);
+
+        std::vector<VId> order(1, root);
+        for(size_t i = 0; i < order.size(); ++i)
+            for(size_t c = childOffsets[order[i]]; c < childOffsets[order[i] + 1]; ++c)
+                order.push_back(children[c]);
+
+        // subtree sums bottom-up, zero for subtrees with landmarks
+        std::vector<bool> hasLandmark(chosen);
+        for(size_t i = order.size(); i-- > 0; )
+        {
+            VId v = order[i];
+            for(size_t c = childOffsets[v]; c < childOffsets[v + 1]; ++c)
+            {
+                sizes[v] += sizes[children[c]];
+                if(hasLandmark[children[c]])
+                    hasLandmark[v] = true;
+            }
+            if(hasLandmark[v])
+                sizes[v] = 0;
+        }
+
+        // descends to the heaviest child
+        VId v = root;
+        for(bool down = true; down; )
+        {
+            down = false;
+            VId best = v;
+            for(size_t c = childOffsets[v]; c < childOffsets[v + 1]; ++c)
+                if(sizes[children[c]] > 0 && (best == v || sizes[best] < sizes[children[c]]))
+                    best = children[c];
+            if(best != v)
+            {
+                v = best;
+                down = true;
+            }
+        }
+        if(!chosen[v])
+            return v;
+
+        // everything is covered: any vertex not chosen yet
+        for(VId u = 0; u < n; ++u)
+            if(!chosen[u])
+                return u;
+        return v;
+    }
+
+protected:
+    std::vector<VId> _landmarks;            ///< Landmarks by rows.
+    size_t _verticesNum;
+    std::vector<Dist> _own;                 ///< Tables that are not mapped.
+    std::shared_ptr<MappedFile> _file;      ///< The mapping, if any.
+    const Dist* _mappedDists;               ///< Tables in the mapping.
+}; // class LandmarkTables
+
+
+/*! ****************************************************************************
+ *  \brief The AltQuery class answers point-to-point queries on a graph by A*
+ *  search with landmark lower bounds as the potential.
+ *
+ *  The potential is consistent on undirected graphs, so every vertex is
+ *  settled at most once and the search stops as soon as the target is
+ *  settled. Vertices that a landmark proves to be in another component
+ *  than the target are never queued. The scratch arrays are kept between
+ *  queries and reset by the touched vertices only. An object is not
+ *  thread-safe; use one per thread.
+ *
+ *  \tparam TGraph is a labeled graph type with dense ids, such as
+ *  CsrEdgeLblUGraph.
+ ******************************************************************************/
+template <typename TGraph>
+class AltQuery {
+public:
+    typedef typename TGraph::VId VId;
+    typedef typename TGraph::Label Dist;
+    typedef LandmarkTables<Dist> Tables;
+
+public:
+    AltQuery(const TGraph& g, const Tables& tables)
+        : _g(g), _tables(tables), _settledNum(0)
+    {
+        if(tables.getVerticesNum() != g.getVerticesNum())
+            throw std::invalid_argument("Landmark tables do not match the graph");
+
+        _dists.assign(g.getVerticesNum(), Tables::infinity());
+        _preds.assign(g.getVerticesNum(), noVertex());
+    }
+
+    static VId noVertex() { return std::numeric_limits<VId>::max(); }
+
+public:
+    /// Returns the distance from \a s to \a t, infinity() if \a t is
+    /// unreachable.
+    Dist getDistance(VId s, VId t) { return run(s, t); }
+
+    /// \brief Finds a shortest path from \a s to \a t and puts its vertices,
+    /// both ends included, to \a path.
+    ///
+    /// \return the distance, or infinity() with an empty \a path if \a t is
+    /// unreachable.
+    Dist getPath(VId s, VId t, std::vector<VId>& path)
+    {
+        path.clear();
+        Dist d = run(s, t);
+        if(d == Tables::infinity())
+            return d;
+
+        for(VId v = t; v != noVertex(); v = _preds[v])
+            path.push_back(v);
+        std::reverse(path.begin(), path.end());
+
+        return d;
+    }
+
+    /// Returns the number of vertices settled by the last query.
+    size_t getSettledNum() const { return _settledNum; }
+
+protected:
+    /// A queued vertex with its distance and the key (distance + potential).
+    struct Entry {
+        Dist key;
+        Dist dist;
+        VId v;
+
+        bool operator>(const Entry& other) const { return other.key < key; }
+    };
+
+    Dist run(VId s, VId t)
+    {
+        if(s >= _g.getVerticesNum() || t >= _g.getVerticesNum())
+            throw std::invalid_argument("Vertex does not exist");
+
+        for(VId v : _touched)
+        {
+            _dists[v] = Tables::infinity();
+            _preds[v] = noVertex();
+        }
+        _touched.clear();
+        _heap = Heap();
+        _settledNum = 0;
+
+        // distances of the target to the landmarks are used for every bound
+        _targetDists.resize(_tables.getLandmarksNum());
+        for(size_t i = 0; i < _targetDists.size(); ++i)
+            _targetDists[i] = _tables.getDistance(i, t);
+
+        relax(s, Dist(), noVertex());
+        while(!_heap.empty())
+        {
+            Entry top = _heap.top();
+            _heap.pop();
+            if(_dists[top.v] < top.dist)
+                continue;                       // outdated entry
+
+            ++_settledNum;
+            if(top.v == t)
+                return top.dist;
+
+            typename TGraph::AdjIterPair adj = _g.getAdjVertices(top.v);
+            typename TGraph::AdjLblIter lbl = _g.getAdjLabels(top.v);
+            for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it, ++lbl)
+            {
+                if(*lbl < Dist())
+                    throw std::invalid_argument("Negative edge label for shortest paths");
+                relax(*it, top.dist + *lbl, top.v);
+            }
+        }
+
+        return Tables::infinity();
+    }
+
+    void relax(VId v, Dist d, VId pred)
+    {
+        if(!(d < _dists[v]))
+            return;
+
+        Dist pot = Dist();
+        for(size_t i = 0; i < _targetDists.size(); ++i)
+            if(!Tables::updateBound(pot, _tables.getRow(i)[v], _targetDists[i]))
+                return;                         // t is unreachable from v
+
+        if(_dists[v] == Tables::infinity())
+            _touched.push_back(v);
+        _dists[v] = d;
+        _preds[v] = pred;
+        _heap.push({d + pot, d, v});
+    }
+
+protected:
+    typedef std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> Heap;
+
+    const TGraph& _g;
+    const Tables& _tables;
+    std::vector<Dist> _dists;
+    std::vector<VId> _preds;
+    std::vector<VId> _touched;
+    std::vector<Dist> _targetDists;
+    Heap _heap;
+    size_t _settledNum;
+}; // class AltQuery
+
+
+#endif // UGRAPH_ALT_HPP
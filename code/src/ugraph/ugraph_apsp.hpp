@@ -0,0 +1,311 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains implementations of all-pairs shortest paths for small
+///             dense undirected graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UGRAPH_APSP_HPP
+#define UGRAPH_APSP_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "par_utils.hpp"
+
+
+/// Result of an all-pairs shortest paths search.
+template <typename Dist>
+struct DistanceMatrix {
+    size_t verticesNum;
+
+    /// Row length of the matrices: a whole number of blocks, plus a cache
+    /// line if rows would be a multiple of 1 KiB apart.
+    size_t stride;
+
+    /// Row-major distances; infinity() for unreachable pairs.
+    std::vector<Dist> dists;
+
+    /// Row-major next hops: the second vertex of a shortest path from the
+    /// row vertex to the column one; noVertex() for unreachable pairs.
+    std::vector<std::uint32_t> next;
+
+    static Dist infinity() { return std::numeric_limits<Dist>::max(); }
+    static std::uint32_t noVertex() { return std::numeric_limits<std::uint32_t>::max(); }
+
+    /// Returns the distance between the vertices \a u and \a v.
+    Dist at(size_t u, size_t v) const { return dists[u * stride + v]; }
+
+    /// Returns the next hop from \a u on the way to \a v.
+    std::uint32_t getNext(size_t u, size_t v) const { return next[u * stride + v]; }
+
+    /// \brief Puts the vertices of a shortest path from \a u to \a v, both
+    /// ends included, to \a path.
+    ///
+    /// Next hops may form a cycle if the graph has zero-length edges; such
+    /// a path can't be restored.
+    ///
+    /// \return false with an empty \a path if \a v is unreachable or the
+    /// path can't be restored.
+    bool getPath(std::uint32_t u, std::uint32_t v, std::vector<std::uint32_t>& path) const
+    {
+        path.clear();
+        if(getNext(u, v) == noVertex())
+            return false;
+
+        path.push_back(u);
+        while(u != v)
+        {
+            if(path.size() > verticesNum)
+            {
+                path.clear();
+                return false;
+            }
+            u = getNext(u, v);
+            path.push_back(u);
+        }
+
+        return true;
+    }
+};
+
+
+namespace apsp_details {
+
+/// \brief Relaxes \a len entries of a distance row \a dst (with next hops
+/// \a dstNext) through the vertex k: dst[j] = min(dst[j], dik + src[j]),
+/// where \a src is the k-th row and \a nik is the next hop towards k.
+///
+/// Written branchless so that compilers may vectorize it for any type.
+template <typename Dist>
+inline void relaxRow(Dist* dst, std::uint32_t* dstNext, const Dist* src,
+                     Dist dik, std::uint32_t nik, size_t len)
+{
+    for(size_t j = 0; j < len; ++j)
+    {
+        Dist s = dik + src[j];
+        bool lt = s < dst[j];
+        dst[j] = lt ? s : dst[j];
+        dstNext[j] = lt ? nik : dstNext[j];
+    }
+}
+
+#if defined(__AVX2__)
+
+/// 8 x int32 AVX2 version; \a len is a multiple of 8.
+inline void relaxRow(std::int32_t* dst, std::uint32_t* dstNext, const std::int32_t* src,
+                     std::int32_t dik, std::uint32_t nik, size_t len)
+{
+    const __m256i vdik = _mm256_set1_epi32(dik);
+    const __m256i vnik = _mm256_set1_epi32(static_cast<int>(nik));
+    for(size_t j = 0; j < len; j += 8)
+    {
+        __m256i s = _mm256_add_epi32(vdik,
+                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + j)));
+        __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + j));
+        __m256i lt = _mm256_cmpgt_epi32(d, s);
+        __m256i n = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dstNext + j));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + j), _mm256_blendv_epi8(d, s, lt));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dstNext + j),
+                            _mm256_blendv_epi8(n, vnik, lt));
+    }
+}
+
+/// 8 x float AVX2 version; \a len is a multiple of 8.
+inline void relaxRow(float* dst, std::uint32_t* dstNext, const float* src,
+                     float dik, std::uint32_t nik, size_t len)
+{
+    const __m256 vdik = _mm256_set1_ps(dik);
+    const __m256 vnik = _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(nik)));
+    for(size_t j = 0; j < len; j += 8)
+    {
+        __m256 s = _mm256_add_ps(vdik, _mm256_loadu_ps(src + j));
+        __m256 d = _mm256_loadu_ps(dst + j);
+        __m256 lt = _mm256_cmp_ps(s, d, _CMP_LT_OQ);
+        __m256 n = _mm256_loadu_ps(reinterpret_cast<const float*>(dstNext + j));
+        _mm256_storeu_ps(dst + j, _mm256_blendv_ps(d, s, lt));
+        _mm256_storeu_ps(reinterpret_cast<float*>(dstNext + j), _mm256_blendv_ps(n, vnik, lt));
+    }
+}
+
+#elif defined(__SSE2__)
+
+/// 4 x int32 SSE2 version; \a len is a multiple of 4.
+inline void relaxRow(std::int32_t* dst, std::uint32_t* dstNext, const std::int32_t* src,
+                     std::int32_t dik, std::uint32_t nik, size_t len)
+{
+    const __m128i vdik = _mm_set1_epi32(dik);
+    const __m128i vnik = _mm_set1_epi32(static_cast<int>(nik));
+    for(size_t j = 0; j < len; j += 4)
+    {
+        __m128i s = _mm_add_epi32(vdik, _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + j)));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + j));
+        __m128i lt = _mm_cmpgt_epi32(d, s);
+        __m128i n = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dstNext + j));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + j),
+                         _mm_or_si128(_mm_and_si128(lt, s), _mm_andnot_si128(lt, d)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dstNext + j),
+                         _mm_or_si128(_mm_and_si128(lt, vnik), _mm_andnot_si128(lt, n)));
+    }
+}
+
+/// 4 x float SSE2 version; \a len is a multiple of 4.
+inline void relaxRow(float* dst, std::uint32_t* dstNext, const float* src,
+                     float dik, std::uint32_t nik, size_t len)
+{
+    const __m128 vdik = _mm_set1_ps(dik);
+    const __m128 vnik = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(nik)));
+    for(size_t j = 0; j < len; j += 4)
+    {
+        __m128 s = _mm_add_ps(vdik, _mm_loadu_ps(src + j));
+        __m128 d = _mm_loadu_ps(dst + j);
+        __m128 lt = _mm_cmplt_ps(s, d);
+        __m128 n = _mm_loadu_ps(reinterpret_cast<const float*>(dstNext + j));
+        _mm_storeu_ps(dst + j, _mm_or_ps(_mm_and_ps(lt, s), _mm_andnot_ps(lt, d)));
+        _mm_storeu_ps(reinterpret_cast<float*>(dstNext + j),
+                      _mm_or_ps(_mm_and_ps(lt, vnik), _mm_andnot_ps(lt, n)));
+    }
+}
+
+#endif // __AVX2__
+
+/// Relaxes the block (ib, jb) of \a m through the vertices of the block kb.
+template <typename Dist>
+void relaxBlock(DistanceMatrix<Dist>& m, size_t ib, size_t jb, size_t kb, size_t bs)
+{
+    const size_t stride = m.stride;
+    for(size_t k = kb * bs; k < (kb + 1) * bs; ++k)
+    {
+        const Dist* src = m.dists.data() + k * stride + jb * bs;
+        for(size_t i = ib * bs; i < (ib + 1) * bs; ++i)
+        {
+            Dist* row = m.dists.data() + i * stride;
+            std::uint32_t* nextRow = m.next.data() + i * stride;
+            relaxRow(row + jb * bs, nextRow + jb * bs, src, row[k], nextRow[k], bs);
+        }
+    }
+}
+
+} // namespace apsp_details
+
+
+/// \brief Finds shortest paths between all pairs of vertices of the graph
+/// \a g with edge labels as lengths by the blocked Floyd–Warshall algorithm,
+/// on \a threadsNum threads.
+///
+/// The graph is first converted to a dense matrix padded to a multiple of
+/// \a blockSize (rounded up to 8). Every round over a block of pivots
+/// updates the diagonal block, then the blocks of its row and column in
+/// parallel, then all the other blocks in parallel, so a working set of
+/// three blocks stays in cache. Rows are relaxed by AVX2 (if the compiler
+/// targets it, see GRAPH_ENABLE_AVX2 in CMake) or SSE2 kernels for int32
+/// and float labels, and by branchless loops for other types.
+///
+/// Labels must be non-negative, and path lengths less than a half of the
+/// maximum label value. Paths are restored from next hops reliably only if
+/// labels are positive. The matrices take n^2 * (sizeof(Label) + 4) bytes,
+/// i.e. 512 MiB for 8192 vertices with int labels.
+///
+/// \tparam TGraph is a labeled graph type with dense ids, such as
+/// CsrEdgeLblUGraph.
+template <typename TGraph>
+DistanceMatrix<typename TGraph::Label>
+    findAllPairsShortestPaths(const TGraph& g, unsigned threadsNum = 0,
+                              size_t blockSize = 64)
+{
+    typedef typename TGraph::VId VId;
+    typedef typename TGraph::Label Dist;
+    typedef DistanceMatrix<Dist> Result;
+
+    const size_t n = g.getVerticesNum();
+    const size_t bs = std::max<size_t>(8, (blockSize + 7) / 8 * 8);
+    const size_t blocksNum = (n + bs - 1) / bs;
+    threadsNum = par::getThreadsNum(threadsNum);
+
+    // sums of two "infinite" values do not overflow
+    const Dist inf = Result::infinity() / 2;
+
+    Result m;
+    m.verticesNum = n;
+    m.stride = blocksNum * bs;
+    if((m.stride * sizeof(Dist)) % 1024 == 0)
+        m.stride += 64 / sizeof(Dist);         // rows 4K apart share cache sets
+    m.dists.assign(m.stride * m.stride, inf);
+    m.next.assign(m.stride * m.stride, Result::noVertex());
+    par::parallelFor(n, threadsNum, [&](size_t u, unsigned)
+    {
+        Dist* row = m.dists.data() + u * m.stride;
+        std::uint32_t* nextRow = m.next.data() + u * m.stride;
+        row[u] = Dist();
+        nextRow[u] = static_cast<std::uint32_t>(u);
+
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(static_cast<VId>(u));
+        typename TGraph::AdjLblIter lbl = g.getAdjLabels(static_cast<VId>(u));
+        for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it, ++lbl)
+        {
+            if(*lbl < Dist())
+                throw std::invalid_argument("Negative edge label for shortest paths");
+            if(*it != u && *lbl < row[*it])
+            {
+                row[*it] = *lbl;
+                nextRow[*it] = *it;
+            }
+        }
+    }, 64);
+
+    for(size_t kb = 0; kb < blocksNum; ++kb)
+    {
+        apsp_details::relaxBlock(m, kb, kb, kb, bs);
+
+        // the row and the column of the pivot block
+        par::parallelFor(2 * blocksNum, threadsNum, [&](size_t t, unsigned)
+        {
+            size_t b = t / 2;
+            if(b == kb)
+                return;
+            if(t % 2)
+                apsp_details::relaxBlock(m, kb, b, kb, bs);
+            else
+                apsp_details::relaxBlock(m, b, kb, kb, bs);
+        }, 1);
+
+        // the rest
+        par::parallelFor(blocksNum * blocksNum, threadsNum, [&](size_t t, unsigned)
+        {
+            size_t ib = t / blocksNum, jb = t % blocksNum;
+            if(ib != kb && jb != kb)
+                apsp_details::relaxBlock(m, ib, jb, kb, bs);
+        }, 1);
+    }
+
+    par::parallelFor(n, threadsNum, [&](size_t u, unsigned)
+    {
+        Dist* row = m.dists.data() + u * m.stride;
+        for(size_t v = 0; v < n; ++v)
+            if(!(row[v] < inf))
+                row[v] = Result::infinity();
+    }, 64);
+
+    return m;
+}
+
+
+#endif // UGRAPH_APSP_HPP
@@ -0,0 +1,336 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains implementations of breadth-first search algorithms
+///             for undirected graphs, including bit-parallel multi-source BFS.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UGRAPH_BFS_HPP
+#define UGRAPH_BFS_HPP
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "bit_utils.hpp"
+#include "csr_ugraph.hpp"
+#include "par_utils.hpp"
+
+
+/// Number of hops meaning that a vertex is unreachable.
+const std::uint32_t BFS_UNREACHABLE = std::numeric_limits<std::uint32_t>::max();
+
+
+/// \brief Finds numbers of hops from the vertex \a src to all other vertices
+/// of the graph \a g.
+///
+/// \return hop distances by dense ids, BFS_UNREACHABLE for unreachable vertices.
+template <typename TGraph>
+std::vector<std::uint32_t> findBfsDistances(const TGraph& g,
+                                            typename TGraph::VId src)
+{
+    typedef typename TGraph::VId VId;
+
+    if(src >= g.getVerticesNum())
+        throw std::invalid_argument("Source vertex does not exist");
+
+    std::vector<std::uint32_t> dists(g.getVerticesNum(), BFS_UNREACHABLE);
+    std::vector<VId> frontier(1, src), next;
+    dists[src] = 0;
+    for(std::uint32_t level = 1; !frontier.empty(); ++level)
+    {
+        for(VId v : frontier)
+        {
+            typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+            for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+                if(dists[*it] == BFS_UNREACHABLE)
+                {
+                    dists[*it] = level;
+                    next.push_back(*it);
+                }
+        }
+        frontier.swap(next);
+        next.clear();
+    }
+
+    return dists;
+}
+
+
+/// Matrix of hop distances from a number of sources to every vertex.
+struct HopDistanceMatrix {
+    size_t sourcesNum;
+    size_t verticesNum;
+
+    /// Row-major distances: a row per source, a column per dense vertex id.
+    std::vector<std::uint32_t> dists;
+
+    /// Returns hops from the \a i-th source to the vertex \a v.
+    std::uint32_t at(size_t i, size_t v) const { return dists[i * verticesNum + v]; }
+};
+
+
+namespace bfs_details {
+
+/*! ****************************************************************************
+ *  \brief Set of BFS instances represented by a bit word of 64 * Lanes bits.
+ *
+ *  The generic version works lane by lane; the 256-bit one is backed by AVX2
+ *  when the compiler targets it (GRAPH_ENABLE_AVX2 in CMake). Loads and stores are unaligned, so words
+ *  can be kept in a plain std::vector.
+ ******************************************************************************/
+template <unsigned Lanes>
+struct BitWord {
+    std::uint64_t w[Lanes];
+
+    void clear()
+    {
+        for(unsigned l = 0; l < Lanes; ++l)
+            w[l] = 0;
+    }
+
+    void setBit(unsigned i) { w[i >> 6] |= std::uint64_t(1) << (i & 63); }
+
+    bool isZero() const
+    {
+        std::uint64_t acc = 0;
+        for(unsigned l = 0; l < Lanes; ++l)
+            acc |= w[l];
+        return acc == 0;
+    }
+
+    /// Checks whether all the bits of \a mask are set in this word.
+    bool covers(const BitWord& mask) const
+    {
+        std::uint64_t acc = 0;
+        for(unsigned l = 0; l < Lanes; ++l)
+            acc |= mask.w[l] & ~w[l];
+        return acc == 0;
+    }
+
+    void orWith(const BitWord& o)
+    {
+        for(unsigned l = 0; l < Lanes; ++l)
+            w[l] |= o.w[l];
+    }
+
+    /// Returns (this & ~o).
+    BitWord andNot(const BitWord& o) const
+    {
+        BitWord r;
+        for(unsigned l = 0; l < Lanes; ++l)
+            r.w[l] = w[l] & ~o.w[l];
+        return r;
+    }
+};
+
+#if defined(__AVX2__)
+template <>
+inline bool BitWord<4>::isZero() const
+{
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w));
+    return _mm256_testz_si256(a, a) != 0;
+}
+
+template <>
+inline bool BitWord<4>::covers(const BitWord<4>& mask) const
+{
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w));
+    __m256i m = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask.w));
+    return _mm256_testc_si256(a, m) != 0;
+}
+
+template <>
+inline void BitWord<4>::orWith(const BitWord<4>& o)
+{
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(o.w));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(w), _mm256_or_si256(a, b));
+}
+
+template <>
+inline BitWord<4> BitWord<4>::andNot(const BitWord<4>& o) const
+{
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(o.w));
+    BitWord<4> r;
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(r.w), _mm256_andnot_si256(b, a));
+    return r;
+}
+#endif // __AVX2__
+
+
+/// Runs one batch of up to 64 * Lanes BFS instances from \a sources, whose
+/// first one corresponds to the row \a firstRow of the matrix \a res.
+template <unsigned Lanes, typename TGraph>
+void runMsBfsBatch(const TGraph& g, const typename TGraph::VId* sources,
+                   unsigned batchSize, size_t firstRow,
+                   HopDistanceMatrix& res, unsigned threadsNum)
+{
+    typedef typename TGraph::VId VId;
+    typedef BitWord<Lanes> Word;
+
+    const size_t n = g.getVerticesNum();
+    Word zero;
+    zero.clear();
+    Word full = zero;
+    for(unsigned i = 0; i < batchSize; ++i)
+        full.setBit(i);
+
+    std::vector<Word> seen(n, zero), visit(n, zero), visitNext(n, zero);
+    std::vector<VId> frontier, next;
+    for(unsigned i = 0; i < batchSize; ++i)
+    {
+        VId s = sources[i];
+        if(seen[s].isZero())
+            frontier.push_back(s);
+        seen[s].setBit(i);
+        visit[s].setBit(i);
+        res.dists[(firstRow + i) * n + s] = 0;
+    }
+
+    // records the distance for all the instances that newly reached u
+    auto settle = [&](VId u, const Word& fresh, std::uint32_t level)
+    {
+        for(unsigned l = 0; l < Lanes; ++l)
+            for(std::uint64_t b = fresh.w[l]; b; b &= b - 1)
+            {
+                size_t row = firstRow + l * 64 + bits::countTrailingZeros(b);
+                res.dists[row * n + u] = level;
+            }
+    };
+
+    const size_t pullThreshold = g.getEdgesNum() / 16 + 1;
+    threadsNum = par::getThreadsNum(threadsNum);
+    std::vector<std::vector<VId>> localNext(threadsNum);
+
+    for(std::uint32_t level = 1; !frontier.empty(); ++level)
+    {
+        size_t frontierEdges = 0;
+        for(VId v : frontier)
+            frontierEdges += g.getDegree(v);
+
+        if(frontierEdges < pullThreshold)
+        {
+            // top-down: a small frontier pushes its words to the neighbours
+            for(VId v : frontier)
+            {
+                typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+                for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+                {
+                    if(visitNext[*it].isZero())
+                        next.push_back(*it);
+                    visitNext[*it].orWith(visit[v]);
+                }
+            }
+
+            size_t kept = 0;
+            for(VId u : next)
+            {
+                Word fresh = visitNext[u].andNot(seen[u]);
+                visitNext[u] = fresh;
+                if(fresh.isZero())
+                    continue;
+
+                seen[u].orWith(fresh);
+                settle(u, fresh, level);
+                next[kept++] = u;
+            }
+            next.resize(kept);
+        }
+        else
+        {
+            // bottom-up: every vertex pulls the words of its neighbours, so
+            // each thread writes its own vertices only
+            par::parallelFor(n, threadsNum, [&](size_t i, unsigned tid)
+            {
+                VId u = static_cast<VId>(i);
+                if(seen[u].covers(full))
+                    return;
+
+                Word acc = zero;
+                typename TGraph::AdjIterPair adj = g.getAdjVertices(u);
+                for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+                    acc.orWith(visit[*it]);
+
+                Word fresh = acc.andNot(seen[u]);
+                if(fresh.isZero())
+                    return;
+
+                visitNext[u] = fresh;
+                seen[u].orWith(fresh);
+                settle(u, fresh, level);
+                localNext[tid].push_back(u);
+            });
+
+            for(std::vector<VId>& ln : localNext)
+            {
+                next.insert(next.end(), ln.begin(), ln.end());
+                ln.clear();
+            }
+        }
+
+        for(VId v : frontier)
+            visit[v] = zero;
+        visit.swap(visitNext);
+        frontier.swap(next);
+        next.clear();
+    }
+}
+
+} // namespace bfs_details
+
+
+/// \brief Finds numbers of hops from each of \a sources to all vertices of the
+/// graph \a g by the bit-parallel multi-source BFS (MS-BFS).
+///
+/// Sources are processed in batches of 64 * Lanes: a single scan of an
+/// adjacency list serves all the BFS instances of a batch at once, each
+/// of them being a bit in a per-vertex word. Lanes == 4 (256 sources per
+/// batch) uses AVX2 kernels if the compiler targets AVX2. Levels with large
+/// frontiers are expanded bottom-up on \a threadsNum threads.
+///
+/// \return matrix of distances, a row per source, BFS_UNREACHABLE for
+/// unreachable vertices.
+template <unsigned Lanes = 4, typename TGraph>
+HopDistanceMatrix findMultiSourceBfsDistances(const TGraph& g,
+                    const std::vector<typename TGraph::VId>& sources,
+                    unsigned threadsNum = 0)
+{
+    const size_t n = g.getVerticesNum();
+    for(typename TGraph::VId s : sources)
+        if(s >= n)
+            throw std::invalid_argument("Source vertex does not exist");
+
+    HopDistanceMatrix res;
+    res.sourcesNum = sources.size();
+    res.verticesNum = n;
+    res.dists.assign(res.sourcesNum * n, BFS_UNREACHABLE);
+
+    const size_t batchWidth = 64 * Lanes;
+    for(size_t first = 0; first < sources.size(); first += batchWidth)
+    {
+        size_t size = std::min(batchWidth, sources.size() - first);
+        bfs_details::runMsBfsBatch<Lanes>(g, sources.data() + first,
+                static_cast<unsigned>(size), first, res, threadsNum);
+    }
+
+    return res;
+}
+
+
+#endif // UGRAPH_BFS_HPP
@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains implementations of bridges, articulation points and
+///             biconnected components search for undirected graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UGRAPH_BICONNECTED_HPP
+#define UGRAPH_BICONNECTED_HPP
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "csr_ugraph.hpp"
+
+
+/// Result of a biconnectivity analysis; all the vertices are dense ids.
+template <typename VId>
+struct Biconnectivity {
+    typedef std::pair<VId, VId> Edge;
+
+    /// Bridges as (parent, child) pairs of the DFS tree.
+    std::vector<Edge> bridges;
+
+    /// Articulation points (cut vertices) in increasing order.
+    std::vector<VId> articulationPoints;
+
+    /// Biconnected components as lists of their edges; a bridge forms a
+    /// component of a single edge.
+    std::vector<std::vector<Edge>> components;
+};
+
+
+/// \brief Finds bridges, articulation points and biconnected components of
+/// the graph \a g by the Hopcroft–Tarjan algorithm.
+///
+/// The DFS uses an explicit stack and a per-vertex position in its adjacency
+/// list instead of recursion, so arbitrarily long paths do not overflow the
+/// call stack. All the working arrays are preallocated by dense ids.
+/// Self-loops never affect biconnectivity and are skipped.
+///
+/// \tparam TGraph is a graph type with dense ids, such as CsrUGraph.
+template <typename TGraph>
+Biconnectivity<typename TGraph::VId> findBiconnectivity(const TGraph& g)
+{
+    typedef typename TGraph::VId VId;
+    typedef typename TGraph::AdjIter AdjIter;
+    typedef typename Biconnectivity<VId>::Edge Edge;
+
+    const size_t n = g.getVerticesNum();
+    const VId none = std::numeric_limits<VId>::max();
+
+    Biconnectivity<VId> res;
+    std::vector<VId> disc(n, none), low(n), parent(n, none);
+    std::vector<AdjIter> next(n);           // next neighbour to look at
+    std::vector<char> isCut(n, 0);
+    std::vector<VId> stack;
+    std::vector<Edge> edgeStack;
+    stack.reserve(n);
+
+    VId time = 0;
+    for(VId root = 0; root < n; ++root)
+    {
+        if(disc[root] != none)
+            continue;
+
+        disc[root] = low[root] = time++;
+        next[root] = g.getAdjVertices(root).first;
+        stack.push_back(root);
+        size_t rootChildren = 0;
+
+        while(!stack.empty())
+        {
+            VId v = stack.back();
+            AdjIter end = g.getAdjVertices(v).second;
+            if(next[v] != end)
+            {
+                VId u = *next[v]++;
+                if(u == v || u == parent[v])
+                    continue;                   // self-loop or the tree edge
+
+                if(disc[u] == none)
+                {
+                    // tree edge: descends
+                    parent[u] = v;
+                    disc[u] = low[u] = time++;
+                    next[u] = g.getAdjVertices(u).first;
+                    edgeStack.push_back({v, u});
+                    stack.push_back(u);
+                    if(v == root)
+                        ++rootChildren;
+                }
+                else if(disc[u] < disc[v])
+                {
+                    // back edge to an ancestor
+                    low[v] = std::min(low[v], disc[u]);
+                    edgeStack.push_back({v, u});
+                }
+                continue;
+            }
+
+            // all the neighbours are done: returns to the parent
+            stack.pop_back();
+            VId p = parent[v];
+            if(p == none)
+                continue;
+
+            low[p] = std::min(low[p], low[v]);
+            if(low[v] > disc[p])
+                res.bridges.push_back({p, v});
+
+            if(low[v] >= disc[p])
+            {
+                if(p != root)
+                    isCut[p] = 1;
+
+                // the subtree of v with p forms a biconnected component
+                res.components.emplace_back();
+                std::vector<Edge>& comp = res.components.back();
+                Edge e;
+                do
+                {
+                    e = edgeStack.back();
+                    edgeStack.pop_back();
+                    comp.push_back(e);
+                }
+                while(!(e.first == p && e.second == v));
+            }
+        }
+
+        if(rootChildren > 1)
+            isCut[root] = 1;
+    }
+
+    for(VId v = 0; v < n; ++v)
+        if(isCut[v])
+            res.articulationPoints.push_back(v);
+
+    return res;
+}
+
+
+#endif // UGRAPH_BICONNECTED_HPP
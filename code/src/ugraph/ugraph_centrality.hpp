@@ -0,0 +1,295 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains implementations of betweenness centrality for
+///             undirected graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UGRAPH_CENTRALITY_HPP
+#define UGRAPH_CENTRALITY_HPP
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "csr_lbl_ugraph.hpp"
+#include "par_utils.hpp"
+
+
+namespace centrality_details {
+
+/// Per-thread working arrays of Brandes' algorithm.
+template <typename VId, typename Dist>
+struct BrandesState {
+    std::vector<Dist> dists;
+    std::vector<double> sigma;          ///< Numbers of shortest paths.
+    std::vector<double> delta;          ///< Dependencies.
+    std::vector<VId> order;             ///< Vertices in order of settling.
+    std::vector<double> bc;             ///< Thread-local accumulator.
+
+    explicit BrandesState(size_t n)
+        : dists(n, std::numeric_limits<Dist>::max()), sigma(n, 0), delta(n, 0),
+          bc(n, 0)
+    {
+    }
+
+    /// Resets the vertices touched by the previous source only.
+    void reset()
+    {
+        for(VId v : order)
+        {
+            dists[v] = std::numeric_limits<Dist>::max();
+            sigma[v] = 0;
+            delta[v] = 0;
+        }
+        order.clear();
+    }
+};
+
+/// Counts shortest paths from \a s by BFS.
+template <typename TGraph, typename VId, typename Dist>
+void countPathsBfs(const TGraph& g, VId s, BrandesState<VId, Dist>& st)
+{
+    st.dists[s] = 0;
+    st.sigma[s] = 1;
+    st.order.push_back(s);
+    for(size_t head = 0; head < st.order.size(); ++head)
+    {
+        VId v = st.order[head];
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+        for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+        {
+            VId u = *it;
+            if(st.dists[u] == std::numeric_limits<Dist>::max())
+            {
+                st.dists[u] = st.dists[v] + 1;
+                st.order.push_back(u);
+            }
+            if(st.dists[u] == st.dists[v] + 1)
+                st.sigma[u] += st.sigma[v];
+        }
+    }
+}
+
+/// Counts shortest paths from \a s by Dijkstra's algorithm.
+template <typename TGraph, typename VId, typename Dist>
+void countPathsDijkstra(const TGraph& g, VId s, BrandesState<VId, Dist>& st)
+{
+    typedef std::pair<Dist, VId> Entry;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+
+    st.dists[s] = Dist();
+    st.sigma[s] = 1;
+    heap.push({Dist(), s});
+    while(!heap.empty())
+    {
+        Entry top = heap.top();
+        heap.pop();
+        VId v = top.second;
+        if(st.dists[v] < top.first)
+            continue;                           // outdated entry
+        st.order.push_back(v);
+
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+        typename TGraph::AdjLblIter lbl = g.getAdjLabels(v);
+        for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it, ++lbl)
+        {
+            VId u = *it;
+            if(u == v)
+                continue;
+            if(!(Dist() < *lbl))
+                throw std::invalid_argument("Edge labels must be positive for betweenness");
+
+            Dist nd = st.dists[v] + *lbl;
+            if(nd < st.dists[u])
+            {
+                st.dists[u] = nd;
+                st.sigma[u] = st.sigma[v];
+                heap.push({nd, u});
+            }
+            else if(nd == st.dists[u])
+                st.sigma[u] += st.sigma[v];
+        }
+    }
+}
+
+/// Accumulates dependencies in the reverse order of settling; \a isPred
+/// tells whether the i-th edge of w comes from a predecessor v.
+template <typename TGraph, typename VId, typename Dist, typename IsPred>
+void accumulate(const TGraph& g, VId s, BrandesState<VId, Dist>& st, IsPred isPred)
+{
+    for(size_t k = st.order.size(); k-- > 0; )
+    {
+        VId w = st.order[k];
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(w);
+        double coef = (1.0 + st.delta[w]) / st.sigma[w];
+        for(size_t i = 0; i < static_cast<size_t>(adj.second - adj.first); ++i)
+        {
+            VId v = adj.first[i];
+            if(v != w && isPred(v, w, i))
+                st.delta[v] += st.sigma[v] * coef;
+        }
+        if(w != s)
+            st.bc[w] += st.delta[w];
+    }
+}
+
+/// Runs Brandes' algorithm from \a sources in parallel and reduces the
+/// thread-local accumulators.
+template <typename Dist, typename TGraph, typename SingleSource>
+std::vector<double> runBrandes(const TGraph& g,
+                               const std::vector<typename TGraph::VId>& sources,
+                               unsigned threadsNum, SingleSource single)
+{
+    typedef typename TGraph::VId VId;
+    typedef BrandesState<VId, Dist> State;
+
+    const size_t n = g.getVerticesNum();
+    threadsNum = par::getThreadsNum(threadsNum);
+    std::vector<std::unique_ptr<State>> states(threadsNum);
+
+    par::parallelFor(sources.size(), threadsNum, [&](size_t i, unsigned tid)
+    {
+        if(!states[tid])
+            states[tid].reset(new State(n));
+        State& st = *states[tid];
+        st.reset();
+        single(sources[i], st);
+    }, 1);
+
+    std::vector<double> res(n, 0.0);
+    par::parallelFor(n, threadsNum, [&](size_t v, unsigned)
+    {
+        double sum = 0;
+        for(const std::unique_ptr<State>& st : states)
+            if(st)
+                sum += st->bc[v];
+        res[v] = sum / 2;                       // every pair is seen twice
+    }, 1 << 12);
+
+    return res;
+}
+
+/// Returns all the vertices, or \a samplesNum random distinct ones.
+template <typename VId>
+std::vector<VId> getSources(size_t n, size_t samplesNum, unsigned seed)
+{
+    std::vector<VId> sources(n);
+    for(size_t i = 0; i < n; ++i)
+        sources[i] = static_cast<VId>(i);
+
+    if(samplesNum && samplesNum < n)
+    {
+        std::mt19937 rnd(seed);
+        for(size_t i = 0; i < samplesNum; ++i)
+            std::swap(sources[i], sources[i + rnd() % (n - i)]);
+        sources.resize(samplesNum);
+    }
+
+    return sources;
+}
+
+/// Scales a sampled estimation to the full number of sources.
+inline void scale(std::vector<double>& bc, size_t n, size_t sourcesNum)
+{
+    if(sourcesNum == 0 || sourcesNum == n)
+        return;
+
+    double k = static_cast<double>(n) / static_cast<double>(sourcesNum);
+    for(double& x : bc)
+        x *= k;
+}
+
+} // namespace centrality_details
+
+
+/// \brief Computes betweenness centrality of all the vertices of the graph
+/// \a g by Brandes' algorithm with BFS, on \a threadsNum threads.
+///
+/// Sources are distributed among threads, each accumulating dependencies
+/// into its own array; the arrays are summed up at the end. If \a samplesNum
+/// is not 0, only that many random sources are used and the result is
+/// scaled up, which gives an unbiased estimation.
+///
+/// \return centralities by dense ids; every unordered pair of vertices is
+/// counted once.
+template <typename TGraph>
+std::vector<double> findBetweennessCentrality(const TGraph& g,
+                                              unsigned threadsNum = 0,
+                                              size_t samplesNum = 0,
+                                              unsigned seed = 5489u)
+{
+    typedef typename TGraph::VId VId;
+    typedef centrality_details::BrandesState<VId, VId> State;
+
+    const size_t n = g.getVerticesNum();
+    std::vector<VId> sources =
+            centrality_details::getSources<VId>(n, samplesNum, seed);
+
+    std::vector<double> res = centrality_details::runBrandes<VId>(g, sources,
+                threadsNum, [&g](VId s, State& st)
+    {
+        centrality_details::countPathsBfs(g, s, st);
+        centrality_details::accumulate(g, s, st, [&st](VId v, VId w, size_t)
+        {
+            return st.dists[v] + 1 == st.dists[w];
+        });
+    });
+    centrality_details::scale(res, n, sources.size());
+
+    return res;
+}
+
+
+/// \brief Computes betweenness centrality of all the vertices of the graph
+/// \a g with edge labels as lengths by Brandes' algorithm with Dijkstra's
+/// one, on \a threadsNum threads.
+///
+/// Labels must be positive. Path lengths are compared exactly, so floating
+/// point labels may miss some of the equally short paths. See
+/// findBetweennessCentrality() for the meaning of the other parameters.
+template <typename TGraph>
+std::vector<double> findWeightedBetweennessCentrality(const TGraph& g,
+                                                      unsigned threadsNum = 0,
+                                                      size_t samplesNum = 0,
+                                                      unsigned seed = 5489u)
+{
+    typedef typename TGraph::VId VId;
+    typedef typename TGraph::Label Dist;
+    typedef centrality_details::BrandesState<VId, Dist> State;
+
+    const size_t n = g.getVerticesNum();
+    std::vector<VId> sources =
+            centrality_details::getSources<VId>(n, samplesNum, seed);
+
+    std::vector<double> res = centrality_details::runBrandes<Dist>(g, sources,
+                threadsNum, [&g](VId s, State& st)
+    {
+        centrality_details::countPathsDijkstra(g, s, st);
+        centrality_details::accumulate(g, s, st, [&g, &st](VId v, VId w, size_t i)
+        {
+            return st.dists[v] != std::numeric_limits<Dist>::max()
+                    && st.dists[v] + g.getAdjLabels(w)[i] == st.dists[w];
+        });
+    });
+    centrality_details::scale(res, n, sources.size());
+
+    return res;
+}
+
+
+#endif // UGRAPH_CENTRALITY_HPP
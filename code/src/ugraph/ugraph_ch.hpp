@@ -0,0 +1,634 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains implementations of contraction hierarchies for fast
+///             point-to-point shortest path queries.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UGRAPH_CH_HPP
+#define UGRAPH_CH_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace ch_details {
+
+/// Dijkstra's scratch arrays that are reset by the touched vertices only.
+template <typename VId, typename Dist>
+struct SearchSpace {
+    typedef std::pair<Dist, VId> Entry;
+    typedef std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> Heap;
+
+    std::vector<Dist> dists;
+    std::vector<VId> preds;
+    std::vector<VId> touched;
+    Heap heap;
+
+    explicit SearchSpace(size_t n = 0)
+        : dists(n, std::numeric_limits<Dist>::max()),
+          preds(n, std::numeric_limits<VId>::max())
+    {
+    }
+
+    /// Lowers the distance of \a v to \a d if it is shorter.
+    bool relax(VId v, Dist d, VId pred)
+    {
+        if(!(d < dists[v]))
+            return false;
+
+        if(dists[v] == std::numeric_limits<Dist>::max())
+            touched.push_back(v);
+        dists[v] = d;
+        preds[v] = pred;
+        heap.push({d, v});
+        return true;
+    }
+
+    void reset()
+    {
+        for(VId v : touched)
+        {
+            dists[v] = std::numeric_limits<Dist>::max();
+            preds[v] = std::numeric_limits<VId>::max();
+        }
+        touched.clear();
+        heap = Heap();
+    }
+};
+
+/// Writes the vector \a v to the stream \a out as raw bytes.
+template <typename T>
+void writeArray(std::ostream& out, const std::vector<T>& v)
+{
+    out.write(reinterpret_cast<const char*>(v.data()),
+              static_cast<std::streamsize>(v.size() * sizeof(T)));
+}
+
+/// Reads \a n elements of the vector \a v from the stream \a in as raw bytes.
+template <typename T>
+void readArray(std::istream& in, std::vector<T>& v, size_t n)
+{
+    v.resize(n);
+    in.read(reinterpret_cast<char*>(v.data()),
+            static_cast<std::streamsize>(n * sizeof(T)));
+}
+
+} // namespace ch_details
+
+
+/*! ****************************************************************************
+ *  \brief The ContractionHierarchy class represents a contraction hierarchies
+ *  index of an undirected graph with non-negative edge lengths.
+ *
+ *  Vertices are contracted one by one in the order of increasing priority,
+ *  which is the edge difference (shortcuts added minus edges removed) plus
+ *  the number of already contracted neighbours; priorities are updated
+ *  lazily. When a vertex is contracted, a shortcut is added between every
+ *  pair of its neighbours unless a limited witness search finds another path
+ *  that is not longer. The index keeps only the edges leading to higher
+ *  ranked vertices, so a query is a pair of small upward searches (see
+ *  ChQuery).
+ *
+ *  The index can be saved to a binary file and loaded back.
+ *
+ *  \tparam Dist represents a trivially copyable type of edge lengths.
+ ******************************************************************************/
+template <typename Dist>
+class ContractionHierarchy {
+public:
+    // type definitions
+
+    /// Dense vertex id.
+    typedef std::uint32_t VId;
+
+    /// Iterator type for upward neighbours.
+    typedef const VId* AdjIter;
+
+    /// Pair of upward neighbours iterators.
+    typedef std::pair<AdjIter, AdjIter> AdjIterPair;
+
+    static Dist infinity() { return std::numeric_limits<Dist>::max(); }
+    static VId noVertex() { return std::numeric_limits<VId>::max(); }
+
+    static_assert(std::is_trivially_copyable<Dist>::value,
+                  "Distances must be trivially copyable to be serialized");
+
+public:
+    /// Creates an empty index.
+    ContractionHierarchy()
+        : _upOffsets(1, 0)
+    {
+    }
+
+    /// \brief Builds the index of the graph \a g with edge labels as lengths.
+    ///
+    /// Every witness search stops after settling \a witnessLimit vertices;
+    /// smaller limits speed up the preprocessing at the cost of redundant
+    /// shortcuts.
+    ///
+    /// \tparam TGraph is a labeled graph type with dense ids, such as
+    /// CsrEdgeLblUGraph.
+    template <typename TGraph>
+    explicit ContractionHierarchy(const TGraph& g, size_t witnessLimit = 500)
+    {
+        build(g, witnessLimit);
+    }
+
+public:
+    size_t getVerticesNum() const { return _ranks.size(); }
+
+    /// Returns the number of upward edges including shortcuts.
+    size_t getEdgesNum() const { return _upAdj.size(); }
+
+    /// Returns the contraction rank of the vertex \a v.
+    std::uint32_t getRank(VId v) const { return _ranks[v]; }
+
+    /// Returns the range of higher ranked neighbours of the vertex \a v.
+    AdjIterPair getUpVertices(VId v) const
+    {
+        return {_upAdj.data() + _upOffsets[v], _upAdj.data() + _upOffsets[v + 1]};
+    }
+
+    /// Returns the lengths of the upward edges of the vertex \a v, ordered
+    /// the same way as getUpVertices(v).
+    const Dist* getUpLengths(VId v) const { return _upDists.data() + _upOffsets[v]; }
+
+    /// Returns the middle vertices of the upward edges of the vertex \a v
+    /// (noVertex() for original edges), ordered as getUpVertices(v).
+    const VId* getUpMiddles(VId v) const { return _upMiddles.data() + _upOffsets[v]; }
+
+    /// Returns the middle vertex of the edge between \a a and \a b, which
+    /// must exist in the index; noVertex() for an original edge.
+    VId getMiddle(VId a, VId b) const
+    {
+        if(_ranks[b] < _ranks[a])
+            std::swap(a, b);
+
+        AdjIterPair up = getUpVertices(a);
+        AdjIter it = std::lower_bound(up.first, up.second, b);
+        if(it == up.second || *it != b)
+            throw std::invalid_argument("Edge does not exist in the hierarchy");
+
+        return getUpMiddles(a)[it - up.first];
+    }
+
+    /// Saves the index to the binary file \a fn.
+    void save(const std::string& fn) const
+    {
+        std::ofstream out(fn, std::ios::binary);
+        if(!out)
+            throw std::invalid_argument("Can't open file for the hierarchy");
+
+        std::uint32_t header[3] = {FILE_MAGIC, FILE_VERSION, sizeof(Dist)};
+        std::uint64_t sizes[2] = {getVerticesNum(), getEdgesNum()};
+        out.write(reinterpret_cast<const char*>(header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(sizes), sizeof(sizes));
+
+        std::vector<std::uint64_t> offsets(_upOffsets.begin(), _upOffsets.end());
+        ch_details::writeArray(out, _ranks);
+        ch_details::writeArray(out, offsets);
+        ch_details::writeArray(out, _upAdj);
+        ch_details::writeArray(out, _upDists);
+        ch_details::writeArray(out, _upMiddles);
+        if(!out)
+            throw std::invalid_argument("Can't write the hierarchy");
+    }
+
+    /// \brief Loads the index from the binary file \a fn made by save().
+    ///
+    /// The file is validated before the index is replaced, so a failed load
+    /// leaves the index as it was.
+    void load(const std::string& fn)
+    {
+        std::ifstream in(fn, std::ios::binary | std::ios::ate);
+        if(!in)
+            throw std::invalid_argument("Can't open file for the hierarchy");
+        const std::uint64_t fileSize = static_cast<std::uint64_t>(in.tellg());
+        in.seekg(0);
+
+        std::uint32_t header[3];
+        std::uint64_t sizes[2];
+        in.read(reinterpret_cast<char*>(header), sizeof(header));
+        in.read(reinterpret_cast<char*>(sizes), sizeof(sizes));
+        if(!in || header[0] != FILE_MAGIC || header[1] != FILE_VERSION
+                || header[2] != sizeof(Dist))
+            throw std::invalid_argument("Not a hierarchy file of this type");
+
+        // sizes not above the file size keep the products below from overflow
+        const std::uint64_t n = sizes[0], m = sizes[1];
+        if(n > fileSize || m > fileSize || n >= noVertex()
+                || fileSize - sizeof(header) - sizeof(sizes)
+                    < n * sizeof(std::uint32_t) + (n + 1) * sizeof(std::uint64_t)
+                      + m * (sizeof(VId) + sizeof(Dist) + sizeof(VId)))
+            throw std::invalid_argument("Truncated hierarchy file");
+
+        std::vector<std::uint32_t> ranks;
+        std::vector<std::uint64_t> offsets;
+        std::vector<VId> upAdj, upMiddles;
+        std::vector<Dist> upDists;
+        ch_details::readArray(in, ranks, n);
+        ch_details::readArray(in, offsets, n + 1);
+        ch_details::readArray(in, upAdj, m);
+        ch_details::readArray(in, upDists, m);
+        ch_details::readArray(in, upMiddles, m);
+        if(!in)
+            throw std::invalid_argument("Truncated hierarchy file");
+
+        bool valid = offsets[0] == 0 && offsets[n] == m;
+        for(size_t v = 0; valid && v < n; ++v)
+            valid = offsets[v] <= offsets[v + 1] && ranks[v] < n;
+        for(size_t i = 0; valid && i < m; ++i)
+            valid = upAdj[i] < n && (upMiddles[i] < n || upMiddles[i] == noVertex());
+        if(!valid)
+            throw std::invalid_argument("Broken hierarchy file");
+
+        _ranks.swap(ranks);
+        _upOffsets.assign(offsets.begin(), offsets.end());
+        _upAdj.swap(upAdj);
+        _upDists.swap(upDists);
+        _upMiddles.swap(upMiddles);
+    }
+
+protected:
+    /// An edge of the remaining graph during the contraction.
+    struct DynEdge {
+        VId to;
+        Dist len;
+        VId middle;
+    };
+
+    /// A shortcut to be added.
+    struct Shortcut {
+        VId from;
+        VId to;
+        Dist len;
+    };
+
+    typedef std::vector<std::vector<DynEdge>> DynGraph;
+    typedef ch_details::SearchSpace<VId, Dist> Space;
+
+    template <typename TGraph>
+    void build(const TGraph& g, size_t witnessLimit)
+    {
+        const size_t n = g.getVerticesNum();
+        DynGraph dyn(n);
+        for(VId v = 0; v < n; ++v)
+        {
+            typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+            typename TGraph::AdjLblIter lbl = g.getAdjLabels(v);
+            for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it, ++lbl)
+            {
+                Dist len = static_cast<Dist>(*lbl);
+                if(len < Dist())
+                    throw std::invalid_argument("Negative edge label for shortest paths");
+                if(*it != v)                    // self-loops are never useful
+                    dyn[v].push_back({*it, len, noVertex()});
+            }
+        }
+
+        // lazy priority queue: a popped vertex is contracted only if its
+        // recomputed priority is still the smallest one
+        typedef std::pair<long long, VId> PrioEntry;
+        std::priority_queue<PrioEntry, std::vector<PrioEntry>,
+                std::greater<PrioEntry>> queue;
+        std::vector<std::uint32_t> contractedNbrs(n, 0);
+        std::vector<Shortcut> shortcuts;
+        Space space(n);
+        for(VId v = 0; v < n; ++v)
+        {
+            findShortcuts(dyn, v, witnessLimit, space, shortcuts);
+            queue.push({getPriority(dyn, v, shortcuts, contractedNbrs), v});
+        }
+
+        std::vector<std::vector<DynEdge>> up(n);
+        _ranks.assign(n, 0);
+        std::uint32_t rank = 0;
+        while(!queue.empty())
+        {
+            VId v = queue.top().second;
+            queue.pop();
+            findShortcuts(dyn, v, witnessLimit, space, shortcuts);
+            long long prio = getPriority(dyn, v, shortcuts, contractedNbrs);
+            if(!queue.empty() && prio > queue.top().first)
+            {
+                queue.push({prio, v});
+                continue;
+            }
+
+            // all the remaining neighbours are ranked higher
+            _ranks[v] = rank++;
+            up[v].swap(dyn[v]);
+            for(const DynEdge& e : up[v])
+            {
+                std::vector<DynEdge>& nb = dyn[e.to];
+                for(size_t i = 0; i < nb.size(); ++i)
+                    if(nb[i].to == v)
+                    {
+                        nb[i] = nb.back();
+                        nb.pop_back();
+                        break;
+                    }
+                ++contractedNbrs[e.to];
+            }
+            for(const Shortcut& sc : shortcuts)
+            {
+                addEdge(dyn, sc.from, sc.to, sc.len, v);
+                addEdge(dyn, sc.to, sc.from, sc.len, v);
+            }
+        }
+
+        // flattens the upward graph sorted by targets
+        _upOffsets.assign(1, 0);
+        _upOffsets.reserve(n + 1);
+        _upAdj.clear();
+        _upDists.clear();
+        _upMiddles.clear();
+        for(VId v = 0; v < n; ++v)
+        {
+            std::sort(up[v].begin(), up[v].end(), [](const DynEdge& a, const DynEdge& b)
+            {
+                return a.to < b.to;
+            });
+            for(const DynEdge& e : up[v])
+            {
+                _upAdj.push_back(e.to);
+                _upDists.push_back(e.len);
+                _upMiddles.push_back(e.middle);
+            }
+            _upOffsets.push_back(_upAdj.size());
+        }
+    }
+
+    /// Edge difference plus the number of contracted neighbours.
+    static long long getPriority(const DynGraph& dyn, VId v,
+                                 const std::vector<Shortcut>& shortcuts,
+                                 const std::vector<std::uint32_t>& contractedNbrs)
+    {
+        return static_cast<long long>(shortcuts.size())
+                - static_cast<long long>(dyn[v].size()) + contractedNbrs[v];
+    }
+
+    /// Adds the edge from \a a to \a b or shortens the existing one.
+    static void addEdge(DynGraph& dyn, VId a, VId b, Dist len, VId middle)
+    {
+        for(DynEdge& e : dyn[a])
+            if(e.to == b)
+            {
+                if(len < e.len)
+                {
+                    e.len = len;
+                    e.middle = middle;
+                }
+                return;
+            }
+        dyn[a].push_back({b, len, middle});
+    }
+
+    /// Collects into \a shortcuts the shortcuts needed to contract \a v.
+    static void findShortcuts(const DynGraph& dyn, VId v, size_t witnessLimit,
+                              Space& space, std::vector<Shortcut>& shortcuts)
+    {
+        shortcuts.clear();
+        const std::vector<DynEdge>& nbrs = dyn[v];
+        if(nbrs.size() < 2)
+            return;
+
+        Dist maxLen = Dist();
+        for(const DynEdge& e : nbrs)
+            maxLen = std::max(maxLen, e.len);
+
+        for(size_t i = 0; i + 1 < nbrs.size(); ++i)
+        {
+            runWitnessSearch(dyn, nbrs[i].to, v, addLengths(nbrs[i].len, maxLen),
+                             witnessLimit, space);
+            for(size_t j = i + 1; j < nbrs.size(); ++j)
+            {
+                Dist len = addLengths(nbrs[i].len, nbrs[j].len);
+                if(len < space.dists[nbrs[j].to])
+                    shortcuts.push_back({nbrs[i].to, nbrs[j].to, len});
+            }
+            space.reset();
+        }
+    }
+
+    /// Dijkstra's search from \a src in the remaining graph avoiding \a v,
+    /// up to the distance \a maxDist.
+    static void runWitnessSearch(const DynGraph& dyn, VId src, VId v, Dist maxDist,
+                                 size_t witnessLimit, Space& space)
+    {
+        space.relax(src, Dist(), noVertex());
+        for(size_t settled = 0; !space.heap.empty() && settled < witnessLimit; ++settled)
+        {
+            typename Space::Entry top = space.heap.top();
+            space.heap.pop();
+            if(space.dists[top.second] < top.first)
+            {
+                --settled;                      // outdated entry
+                continue;
+            }
+            if(maxDist < top.first)
+                break;
+
+            for(const DynEdge& e : dyn[top.second])
+                if(e.to != v)
+                    space.relax(e.to, addLengths(top.first, e.len), top.second);
+        }
+    }
+
+    /// Adds lengths saturating at infinity().
+    static Dist addLengths(Dist a, Dist b)
+    {
+        return (infinity() - a < b) ? infinity() : a + b;
+    }
+
+protected:
+    static const std::uint32_t FILE_MAGIC = 0x48434755;    ///< "UGCH"
+    static const std::uint32_t FILE_VERSION = 1;
+
+    std::vector<std::uint32_t> _ranks;      ///< Contraction ranks.
+    std::vector<size_t> _upOffsets;         ///< Offsets of the upward edges.
+    std::vector<VId> _upAdj;                ///< Targets of the upward edges.
+    std::vector<Dist> _upDists;             ///< Lengths of the upward edges.
+    std::vector<VId> _upMiddles;            ///< Middles of shortcuts.
+}; // class ContractionHierarchy
+
+
+/*! ****************************************************************************
+ *  \brief The ChQuery class answers point-to-point queries on a
+ *  ContractionHierarchy.
+ *
+ *  A query runs Dijkstra's searches over upward edges from both ends in turn;
+ *  each one stops once its smallest key is not less than the best meeting
+ *  distance found, and vertices reached shorter from above are stalled. The
+ *  scratch arrays are kept between queries and reset by
+ *  the touched vertices only, so a query costs the size of the search spaces,
+ *  not of the graph. An object is not thread-safe; use one per thread.
+ ******************************************************************************/
+template <typename Dist>
+class ChQuery {
+public:
+    typedef ContractionHierarchy<Dist> Hierarchy;
+    typedef typename Hierarchy::VId VId;
+
+public:
+    explicit ChQuery(const Hierarchy& ch)
+        : _ch(ch), _fwd(ch.getVerticesNum()), _bwd(ch.getVerticesNum())
+    {
+    }
+
+public:
+    /// Returns the distance from \a s to \a t, infinity() if \a t is
+    /// unreachable.
+    Dist getDistance(VId s, VId t)
+    {
+        VId meet;
+        return run(s, t, meet);
+    }
+
+    /// \brief Finds a shortest path from \a s to \a t and puts its vertices,
+    /// both ends included, to \a path.
+    ///
+    /// \return the distance, or infinity() with an empty \a path if \a t is
+    /// unreachable.
+    Dist getPath(VId s, VId t, std::vector<VId>& path)
+    {
+        path.clear();
+        VId meet;
+        Dist d = run(s, t, meet);
+        if(d == Hierarchy::infinity())
+            return d;
+
+        // upward chain from s reversed, then the one to t
+        std::vector<VId> chain;
+        for(VId v = meet; v != Hierarchy::noVertex(); v = _fwd.preds[v])
+            chain.push_back(v);
+        std::reverse(chain.begin(), chain.end());
+        for(VId v = _bwd.preds[meet]; v != Hierarchy::noVertex(); v = _bwd.preds[v])
+            chain.push_back(v);
+
+        path.push_back(chain[0]);
+        for(size_t i = 1; i < chain.size(); ++i)
+            unpackEdge(chain[i - 1], chain[i], path);
+
+        return d;
+    }
+
+protected:
+    typedef ch_details::SearchSpace<VId, Dist> Space;
+
+    Dist run(VId s, VId t, VId& meet)
+    {
+        if(s >= _ch.getVerticesNum() || t >= _ch.getVerticesNum())
+            throw std::invalid_argument("Vertex does not exist");
+
+        _fwd.reset();
+        _bwd.reset();
+        _fwd.relax(s, Dist(), Hierarchy::noVertex());
+        _bwd.relax(t, Dist(), Hierarchy::noVertex());
+
+        Dist best = Hierarchy::infinity();
+        meet = Hierarchy::noVertex();
+        bool fwdTurn = true;
+        while(true)
+        {
+            bool fwdDone = _fwd.heap.empty() || !(_fwd.heap.top().first < best);
+            bool bwdDone = _bwd.heap.empty() || !(_bwd.heap.top().first < best);
+            if(fwdDone && bwdDone)
+                break;
+
+            if(fwdDone)
+                fwdTurn = false;
+            else if(bwdDone)
+                fwdTurn = true;
+
+            if(fwdTurn)
+                settle(_fwd, _bwd, best, meet);
+            else
+                settle(_bwd, _fwd, best, meet);
+            fwdTurn = !fwdTurn;
+        }
+
+        return best;
+    }
+
+    /// Settles the next vertex of \a space and updates the meeting point.
+    void settle(Space& space, const Space& other, Dist& best, VId& meet)
+    {
+        typename Space::Entry top = space.heap.top();
+        space.heap.pop();
+        VId v = top.second;
+        if(space.dists[v] < top.first)
+            return;                             // outdated entry
+
+        Dist od = other.dists[v];
+        if(od != Hierarchy::infinity() && top.first + od < best)
+        {
+            best = top.first + od;
+            meet = v;
+        }
+
+        // stall-on-demand: if a higher neighbour already reaches v shorter,
+        // v is not on a shortest up-path and its edges are not relaxed
+        typename Hierarchy::AdjIterPair up = _ch.getUpVertices(v);
+        const Dist* lens = _ch.getUpLengths(v);
+        for(size_t i = 0; i < static_cast<size_t>(up.second - up.first); ++i)
+        {
+            Dist du = space.dists[up.first[i]];
+            if(du != Hierarchy::infinity() && du + lens[i] < top.first)
+                return;
+        }
+
+        for(typename Hierarchy::AdjIter it = up.first; it != up.second; ++it, ++lens)
+            space.relax(*it, top.first + *lens, v);
+    }
+
+    /// Appends the vertices of the edge (a, b) with shortcuts unpacked,
+    /// except \a a itself, to \a path.
+    void unpackEdge(VId a, VId b, std::vector<VId>& path)
+    {
+        _stack.clear();
+        _stack.push_back({a, b});
+        while(!_stack.empty())
+        {
+            std::pair<VId, VId> e = _stack.back();
+            _stack.pop_back();
+            VId mid = _ch.getMiddle(e.first, e.second);
+            if(mid == Hierarchy::noVertex())
+                path.push_back(e.second);
+            else
+            {
+                _stack.push_back({mid, e.second});
+                _stack.push_back({e.first, mid});
+            }
+        }
+    }
+
+protected:
+    const Hierarchy& _ch;
+    Space _fwd;
+    Space _bwd;
+    std::vector<std::pair<VId, VId>> _stack;
+}; // class ChQuery
+
+
+#endif // UGRAPH_CH_HPP
@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains implementations of parallel greedy coloring of
+///             undirected graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UGRAPH_COLORING_HPP
+#define UGRAPH_COLORING_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "bit_utils.hpp"
+#include "csr_ugraph.hpp"
+#include "par_utils.hpp"
+#include "ugraph_kcore.hpp"
+
+
+/// Vertex orderings for greedy coloring.
+enum class ColoringOrder {
+    random,         ///< Random priorities.
+    largestFirst,   ///< Higher degree first, random among equal degrees.
+    smallestLast    ///< Reversed degeneracy (min-degree peeling) order.
+};
+
+
+/// Result of a graph coloring.
+struct GraphColoring {
+    /// Colors 0..colorsNum-1 of the vertices by dense ids.
+    std::vector<std::uint32_t> colors;
+
+    /// Number of used colors.
+    std::uint32_t colorsNum;
+
+    /// Duration of every round in seconds.
+    std::vector<double> roundTimes;
+};
+
+
+/// \brief Colors the graph \a g by the Jones–Plassmann algorithm on
+/// \a threadsNum threads.
+///
+/// Vertices get priorities according to \a order (ties broken randomly by
+/// \a seed). In every round, all uncolored vertices whose priorities are
+/// higher than the ones of their uncolored neighbours form an independent set
+/// and take the smallest colors not used by their neighbours, in parallel.
+/// The result is the same as the sequential greedy coloring in the priority
+/// order and does not depend on the number of threads. Every thread keeps
+/// a single forbidden-colors bitset sized by the maximum degree. Self-loops
+/// are ignored.
+template <typename TGraph>
+GraphColoring colorGraphJonesPlassmann(const TGraph& g,
+                    ColoringOrder order = ColoringOrder::random,
+                    unsigned threadsNum = 0, unsigned seed = 5489u)
+{
+    typedef typename TGraph::VId VId;
+    typedef std::chrono::steady_clock Clock;
+
+    const size_t n = g.getVerticesNum();
+    const std::uint32_t none = std::numeric_limits<std::uint32_t>::max();
+    threadsNum = par::getThreadsNum(threadsNum);
+
+    // priorities: the order goes to the high half, a random tie-breaker
+    // to the low one; equal keys are broken by ids
+    std::vector<std::uint64_t> prio(n);
+    std::vector<std::uint32_t> slPos;
+    if(order == ColoringOrder::smallestLast)
+    {
+        std::vector<std::uint32_t> peel = findCoreNumbers(g).peelOrder;
+        slPos.resize(n);
+        for(size_t i = 0; i < n; ++i)
+            slPos[peel[i]] = static_cast<std::uint32_t>(i);   // last peeled first
+    }
+
+    size_t maxDeg = 0;
+    for(VId v = 0; v < n; ++v)
+        maxDeg = std::max(maxDeg, g.getDegree(v));
+
+    par::parallelFor(n, threadsNum, [&](size_t i, unsigned)
+    {
+        std::uint64_t rnd = bits::mix64(seed ^ bits::mix64(i)) & 0xffffffffULL;
+        std::uint64_t hi = 0;
+        if(order == ColoringOrder::largestFirst)
+            hi = g.getDegree(static_cast<VId>(i));
+        else if(order == ColoringOrder::smallestLast)
+            hi = slPos[i];
+        else
+            hi = rnd;
+        prio[i] = (hi << 32) | rnd;
+    }, 1 << 12);
+
+    auto higher = [&prio](VId a, VId b)
+    {
+        return prio[a] > prio[b] || (prio[a] == prio[b] && a > b);
+    };
+
+    GraphColoring res;
+    res.colors.assign(n, none);
+    res.colorsNum = 0;
+
+    const size_t words = (maxDeg + 1) / 64 + 1;
+    std::vector<std::vector<std::uint64_t>> forbidden(threadsNum,
+                std::vector<std::uint64_t>(words, 0));
+    std::vector<std::vector<VId>> localSel(threadsNum);
+    std::vector<VId> remaining(n), selected;
+    for(size_t i = 0; i < n; ++i)
+        remaining[i] = static_cast<VId>(i);
+
+    while(!remaining.empty())
+    {
+        Clock::time_point start = Clock::now();
+
+        // selects local maxima among uncolored vertices
+        par::parallelFor(remaining.size(), threadsNum, [&](size_t i, unsigned tid)
+        {
+            VId v = remaining[i];
+            typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+            for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+                if(*it != v && res.colors[*it] == none && higher(*it, v))
+                    return;
+            localSel[tid].push_back(v);
+        }, 256);
+
+        selected.clear();
+        for(std::vector<VId>& ls : localSel)
+        {
+            selected.insert(selected.end(), ls.begin(), ls.end());
+            ls.clear();
+        }
+
+        // colors the independent set
+        par::parallelFor(selected.size(), threadsNum, [&](size_t i, unsigned tid)
+        {
+            VId v = selected[i];
+            std::vector<std::uint64_t>& forb = forbidden[tid];
+            typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+            size_t deg = g.getDegree(v);
+            for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+            {
+                std::uint32_t c = res.colors[*it];
+                if(c <= deg)                    // greater ones never block
+                    forb[c >> 6] |= std::uint64_t(1) << (c & 63);
+            }
+
+            size_t used = deg / 64 + 1;
+            std::uint32_t c = 0;
+            for(size_t w = 0; w < used; ++w)
+                if(~forb[w])
+                {
+                    c = static_cast<std::uint32_t>(w * 64 + bits::countTrailingZeros(~forb[w]));
+                    break;
+                }
+            res.colors[v] = c;
+
+            for(size_t w = 0; w < used; ++w)
+                forb[w] = 0;
+        }, 256);
+
+        // drops colored vertices
+        size_t kept = 0;
+        for(VId v : remaining)
+            if(res.colors[v] == none)
+                remaining[kept++] = v;
+        remaining.resize(kept);
+
+        std::chrono::duration<double> dur = Clock::now() - start;
+        res.roundTimes.push_back(dur.count());
+    }
+
+    for(std::uint32_t c : res.colors)
+        res.colorsNum = std::max(res.colorsNum, c + 1);
+
+    return res;
+}
+
+
+#endif // UGRAPH_COLORING_HPP
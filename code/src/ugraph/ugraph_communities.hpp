@@ -0,0 +1,524 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains implementations of community detection (label
+///             propagation and Louvain) for undirected graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UGRAPH_COMMUNITIES_HPP
+#define UGRAPH_COMMUNITIES_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "bit_utils.hpp"
+#include "csr_lbl_ugraph.hpp"
+#include "lbl_ugraph.hpp"
+#include "par_utils.hpp"
+
+
+/// Result of a community detection.
+struct Communities {
+    /// Community ids 0..commsNum-1 of the vertices by dense ids.
+    std::vector<std::uint32_t> commIds;
+
+    /// Number of communities.
+    std::uint32_t commsNum;
+
+    /// Modularity of the partition.
+    double modularity;
+
+    /// For the multilevel methods, community ids of the vertices after
+    /// every level, the last one being equal to commIds.
+    std::vector<std::vector<std::uint32_t>> levels;
+};
+
+
+namespace communities_details {
+
+/// Flat weighted adjacency without self-loops used by all the levels.
+///
+/// Following the adjacency matrix convention, a self-loop of weight w adds
+/// 2w to selfWeights and to the degree of its vertex.
+struct WeightedGraph {
+    std::vector<size_t> offsets;
+    std::vector<std::uint32_t> adj;
+    std::vector<double> weights;
+    std::vector<double> selfWeights;
+    std::vector<double> degrees;        ///< Weighted degrees.
+    double totalWeight;                 ///< Sum of degrees, i.e. 2m.
+
+    size_t getVerticesNum() const { return selfWeights.size(); }
+
+    /// Computes the degrees and the total weight.
+    void finish()
+    {
+        const size_t n = getVerticesNum();
+        degrees.assign(n, 0);
+        totalWeight = 0;
+        for(size_t v = 0; v < n; ++v)
+        {
+            double d = selfWeights[v];
+            for(size_t i = offsets[v]; i < offsets[v + 1]; ++i)
+                d += weights[i];
+            degrees[v] = d;
+            totalWeight += d;
+        }
+    }
+};
+
+/// Makes a weighted graph of \a g with labels as weights.
+template <typename TGraph>
+WeightedGraph makeWeightedGraph(const TGraph& g)
+{
+    typedef typename TGraph::VId VId;
+
+    const size_t n = g.getVerticesNum();
+    WeightedGraph wg;
+    wg.offsets.reserve(n + 1);
+    wg.offsets.push_back(0);
+    wg.selfWeights.assign(n, 0);
+    for(VId v = 0; v < n; ++v)
+    {
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+        typename TGraph::AdjLblIter lbl = g.getAdjLabels(v);
+        for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it, ++lbl)
+        {
+            double w = static_cast<double>(*lbl);
+            if(w < 0)
+                throw std::invalid_argument("Edge weights must be non-negative");
+
+            if(*it == v)
+                wg.selfWeights[v] = 2 * w;
+            else
+            {
+                wg.adj.push_back(*it);
+                wg.weights.push_back(w);
+            }
+        }
+        wg.offsets.push_back(wg.adj.size());
+    }
+    wg.finish();
+
+    return wg;
+}
+
+/// Per-thread sparse accumulator of weights by community ids.
+struct WeightAccumulator {
+    std::vector<double> sums;
+    std::vector<std::uint32_t> touched;
+
+    explicit WeightAccumulator(size_t n = 0)
+        : sums(n, -1.0)
+    {
+    }
+
+    void add(std::uint32_t c, double w)
+    {
+        if(sums[c] < 0)
+        {
+            sums[c] = 0;
+            touched.push_back(c);
+        }
+        sums[c] += w;
+    }
+
+    void clear()
+    {
+        for(std::uint32_t c : touched)
+            sums[c] = -1.0;
+        touched.clear();
+    }
+};
+
+/// Renumbers community ids to 0..k-1 in order of first appearance and
+/// returns k.
+inline std::uint32_t renumber(std::vector<std::uint32_t>& ids)
+{
+    const std::uint32_t none = std::numeric_limits<std::uint32_t>::max();
+    std::vector<std::uint32_t> newIds(ids.size(), none);
+    std::uint32_t k = 0;
+    for(std::uint32_t& c : ids)
+    {
+        if(newIds[c] == none)
+            newIds[c] = k++;
+        c = newIds[c];
+    }
+
+    return k;
+}
+
+/// Computes the modularity of the partition \a ids of \a wg into
+/// \a commsNum communities.
+inline double getModularity(const WeightedGraph& wg,
+                            const std::vector<std::uint32_t>& ids,
+                            std::uint32_t commsNum)
+{
+    if(wg.totalWeight <= 0)
+        return 0;
+
+    std::vector<double> inner(commsNum, 0), tot(commsNum, 0);
+    for(size_t v = 0; v < wg.getVerticesNum(); ++v)
+    {
+        std::uint32_t c = ids[v];
+        tot[c] += wg.degrees[v];
+        inner[c] += wg.selfWeights[v];
+        for(size_t i = wg.offsets[v]; i < wg.offsets[v + 1]; ++i)
+            if(ids[wg.adj[i]] == c)
+                inner[c] += wg.weights[i];
+    }
+
+    double q = 0;
+    for(std::uint32_t c = 0; c < commsNum; ++c)
+        q += inner[c] / wg.totalWeight
+                - (tot[c] / wg.totalWeight) * (tot[c] / wg.totalWeight);
+
+    return q;
+}
+
+/// \brief Moves vertices of \a wg between communities \a ids greedily by
+/// the modularity gain, in a random order given by \a seed.
+///
+/// \return true if any vertex has been moved.
+inline bool moveLocally(const WeightedGraph& wg, std::vector<std::uint32_t>& ids,
+                        unsigned seed)
+{
+    const size_t n = wg.getVerticesNum();
+    std::vector<double> tot(wg.degrees);
+    std::vector<std::uint32_t> order(n);
+    for(size_t i = 0; i < n; ++i)
+    {
+        ids[i] = static_cast<std::uint32_t>(i);
+        order[i] = static_cast<std::uint32_t>(i);
+    }
+    std::sort(order.begin(), order.end(), [seed](std::uint32_t a, std::uint32_t b)
+    {
+        return bits::mix64(seed ^ bits::mix64(a)) < bits::mix64(seed ^ bits::mix64(b));
+    });
+
+    const double eps = 1e-12;
+    WeightAccumulator acc(n);
+    bool movedAny = false;
+    for(bool moved = true; moved; )
+    {
+        moved = false;
+        for(std::uint32_t v : order)
+        {
+            std::uint32_t own = ids[v];
+            double kv = wg.degrees[v];
+            acc.add(own, 0);
+            for(size_t i = wg.offsets[v]; i < wg.offsets[v + 1]; ++i)
+                acc.add(ids[wg.adj[i]], wg.weights[i]);
+
+            // the gain of joining c after leaving own is proportional to
+            // k_v,c - tot_c * k_v / 2m
+            tot[own] -= kv;
+            std::uint32_t best = own;
+            double bestGain = acc.sums[own] - tot[own] * kv / wg.totalWeight;
+            for(std::uint32_t c : acc.touched)
+            {
+                double gain = acc.sums[c] - tot[c] * kv / wg.totalWeight;
+                if(gain > bestGain + eps)
+                {
+                    best = c;
+                    bestGain = gain;
+                }
+            }
+            tot[best] += kv;
+            acc.clear();
+
+            if(best != own)
+            {
+                ids[v] = best;
+                moved = movedAny = true;
+            }
+        }
+    }
+
+    return movedAny;
+}
+
+/// Contracts every community of \a ids (numbered 0..commsNum-1) of \a wg to
+/// a single vertex, on \a threadsNum threads.
+inline WeightedGraph contract(const WeightedGraph& wg,
+                              const std::vector<std::uint32_t>& ids,
+                              std::uint32_t commsNum, unsigned threadsNum)
+{
+    const size_t n = wg.getVerticesNum();
+
+    // groups vertices by communities
+    std::vector<size_t> memOffsets(commsNum + 1, 0);
+    for(std::uint32_t c : ids)
+        ++memOffsets[c + 1];
+    for(std::uint32_t c = 0; c < commsNum; ++c)
+        memOffsets[c + 1] += memOffsets[c];
+    std::vector<std::uint32_t> members(n);
+    std::vector<size_t> pos(memOffsets.begin(), memOffsets.end() - 1);
+    for(size_t v = 0; v < n; ++v)
+        members[pos[ids[v]]++] = static_cast<std::uint32_t>(v);
+
+    // sums weights between communities, one community per task
+    typedef std::vector<std::pair<std::uint32_t, double>> Row;
+    std::vector<Row> rows(commsNum);
+    WeightedGraph res;
+    res.selfWeights.assign(commsNum, 0);
+    std::vector<WeightAccumulator> accs(threadsNum, WeightAccumulator(commsNum));
+    par::parallelFor(commsNum, threadsNum, [&](size_t c, unsigned tid)
+    {
+        WeightAccumulator& acc = accs[tid];
+        double self = 0;
+        for(size_t k = memOffsets[c]; k < memOffsets[c + 1]; ++k)
+        {
+            std::uint32_t v = members[k];
+            self += wg.selfWeights[v];
+            for(size_t i = wg.offsets[v]; i < wg.offsets[v + 1]; ++i)
+            {
+                std::uint32_t d = ids[wg.adj[i]];
+                if(d == c)
+                    self += wg.weights[i];      // seen from both ends
+                else
+                    acc.add(d, wg.weights[i]);
+            }
+        }
+
+        std::sort(acc.touched.begin(), acc.touched.end());
+        for(std::uint32_t d : acc.touched)
+            rows[c].push_back({d, acc.sums[d]});
+        res.selfWeights[c] = self;
+        acc.clear();
+    }, 64);
+
+    res.offsets.reserve(commsNum + 1);
+    res.offsets.push_back(0);
+    for(const Row& row : rows)
+    {
+        for(const std::pair<std::uint32_t, double>& e : row)
+        {
+            res.adj.push_back(e.first);
+            res.weights.push_back(e.second);
+        }
+        res.offsets.push_back(res.adj.size());
+    }
+    res.finish();
+
+    return res;
+}
+
+} // namespace communities_details
+
+
+/// \brief Computes the modularity of the partition \a commIds of the graph
+/// \a g with edge labels as weights.
+template <typename TGraph>
+double getModularity(const TGraph& g, const std::vector<std::uint32_t>& commIds)
+{
+    if(commIds.size() != g.getVerticesNum())
+        throw std::invalid_argument("Community ids do not match the graph");
+
+    std::uint32_t commsNum = 0;
+    for(std::uint32_t c : commIds)
+        commsNum = std::max(commsNum, c + 1);
+
+    return communities_details::getModularity(
+                communities_details::makeWeightedGraph(g), commIds, commsNum);
+}
+
+
+/// \brief Detects communities of the graph \a g with edge labels as weights
+/// by asynchronous label propagation on \a threadsNum threads.
+///
+/// Every vertex takes the label of the heaviest adjacent group of vertices
+/// (keeping its own one on ties). Labels are updated in place, so vertices
+/// see the changes of the same round. Only the vertices whose neighbours
+/// have changed their labels are processed in the next round; the process
+/// stops when no vertex is active or after \a maxRounds rounds. The initial
+/// order of vertices is shuffled by \a seed; the result depends on the
+/// scheduling of threads if there are more than one.
+template <typename TGraph>
+Communities findCommunitiesLabelPropagation(const TGraph& g,
+                                            unsigned threadsNum = 0,
+                                            size_t maxRounds = 100,
+                                            unsigned seed = 5489u)
+{
+    using namespace communities_details;
+
+    const size_t n = g.getVerticesNum();
+    threadsNum = par::getThreadsNum(threadsNum);
+    WeightedGraph wg = makeWeightedGraph(g);
+
+    std::vector<std::atomic<std::uint32_t>> labels(n);
+    std::vector<std::atomic<unsigned char>> active(n);
+    std::vector<std::uint32_t> frontier(n);
+    for(size_t v = 0; v < n; ++v)
+    {
+        labels[v].store(static_cast<std::uint32_t>(v), std::memory_order_relaxed);
+        active[v].store(0, std::memory_order_relaxed);
+        frontier[v] = static_cast<std::uint32_t>(v);
+    }
+    std::sort(frontier.begin(), frontier.end(), [seed](std::uint32_t a, std::uint32_t b)
+    {
+        return bits::mix64(seed ^ bits::mix64(a)) < bits::mix64(seed ^ bits::mix64(b));
+    });
+
+    std::vector<WeightAccumulator> accs(threadsNum, WeightAccumulator(n));
+    std::vector<std::vector<std::uint32_t>> localNext(threadsNum);
+    for(size_t round = 0; round < maxRounds && !frontier.empty(); ++round)
+    {
+        par::parallelFor(frontier.size(), threadsNum, [&](size_t i, unsigned tid)
+        {
+            std::uint32_t v = frontier[i];
+            active[v].store(0, std::memory_order_relaxed);
+
+            WeightAccumulator& acc = accs[tid];
+            std::uint32_t own = labels[v].load(std::memory_order_relaxed);
+            acc.add(own, 0);
+            for(size_t k = wg.offsets[v]; k < wg.offsets[v + 1]; ++k)
+                acc.add(labels[wg.adj[k]].load(std::memory_order_relaxed),
+                        wg.weights[k]);
+
+            std::uint32_t best = own;
+            for(std::uint32_t c : acc.touched)
+                if(acc.sums[c] > acc.sums[best])
+                    best = c;
+            acc.clear();
+            if(best == own)
+                return;
+
+            labels[v].store(best, std::memory_order_relaxed);
+            for(size_t k = wg.offsets[v]; k < wg.offsets[v + 1]; ++k)
+            {
+                std::uint32_t u = wg.adj[k];
+                if(!active[u].exchange(1, std::memory_order_relaxed))
+                    localNext[tid].push_back(u);
+            }
+        }, 256);
+
+        frontier.clear();
+        for(std::vector<std::uint32_t>& ln : localNext)
+        {
+            frontier.insert(frontier.end(), ln.begin(), ln.end());
+            ln.clear();
+        }
+    }
+
+    Communities res;
+    res.commIds.resize(n);
+    for(size_t v = 0; v < n; ++v)
+        res.commIds[v] = labels[v].load(std::memory_order_relaxed);
+    res.commsNum = renumber(res.commIds);
+    res.modularity = communities_details::getModularity(wg, res.commIds, res.commsNum);
+
+    return res;
+}
+
+
+/// \brief Detects communities of the graph \a g with edge labels as weights
+/// by the multilevel Louvain method.
+///
+/// On every level, vertices are greedily moved to the neighbouring
+/// communities with the best modularity gain until no move improves it;
+/// then every community is contracted to a single weighted vertex (with
+/// the inner weight kept as a self-loop) and the next level starts on the
+/// contracted graph, which is built on \a threadsNum threads. The process
+/// stops when a level moves no vertex. Labels must be non-negative.
+template <typename TGraph>
+Communities findCommunitiesLouvain(const TGraph& g, unsigned threadsNum = 0,
+                                   unsigned seed = 5489u)
+{
+    using namespace communities_details;
+
+    const size_t n = g.getVerticesNum();
+    threadsNum = par::getThreadsNum(threadsNum);
+    WeightedGraph wg = makeWeightedGraph(g);
+
+    Communities res;
+    res.commIds.resize(n);
+    for(size_t v = 0; v < n; ++v)
+        res.commIds[v] = static_cast<std::uint32_t>(v);
+    res.commsNum = static_cast<std::uint32_t>(n);
+
+    WeightedGraph cur;
+    const WeightedGraph* level = &wg;
+    std::vector<std::uint32_t> ids;
+    for(unsigned lvl = 0; level->totalWeight > 0; ++lvl)
+    {
+        ids.resize(level->getVerticesNum());
+        if(!moveLocally(*level, ids, seed + lvl))
+            break;
+
+        std::uint32_t k = renumber(ids);
+        for(std::uint32_t& c : res.commIds)
+            c = ids[c];
+        res.commsNum = k;
+        res.levels.push_back(res.commIds);
+
+        cur = contract(*level, ids, k, threadsNum);
+        level = &cur;
+    }
+    if(res.levels.empty())
+        res.levels.push_back(res.commIds);
+    res.modularity = communities_details::getModularity(wg, res.commIds, res.commsNum);
+
+    return res;
+}
+
+
+/// \brief Makes a coarse graph of the communities \a commIds of the graph
+/// \a g, e.g. for writing it with the DOT writer.
+///
+/// Vertices of the result are community ids; an edge between two
+/// communities is labeled with the sum of the labels of the edges between
+/// them, and a self-loop with the sum of the labels of the inner edges.
+template <typename TGraph>
+EdgeLblUGraph<std::uint32_t, typename TGraph::Label>
+makeCommunityGraph(const TGraph& g, const std::vector<std::uint32_t>& commIds)
+{
+    typedef typename TGraph::VId VId;
+    typedef typename TGraph::Label Label;
+
+    if(commIds.size() != g.getVerticesNum())
+        throw std::invalid_argument("Community ids do not match the graph");
+
+    std::map<std::pair<std::uint32_t, std::uint32_t>, Label> sums;
+    EdgeLblUGraph<std::uint32_t, Label> res;
+    for(VId v = 0; v < g.getVerticesNum(); ++v)
+    {
+        res.addVertex(commIds[v]);
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+        typename TGraph::AdjLblIter lbl = g.getAdjLabels(v);
+        for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it, ++lbl)
+        {
+            if(*it < v)
+                continue;                       // every edge once
+
+            std::uint32_t a = commIds[v], b = commIds[*it];
+            std::pair<std::uint32_t, std::uint32_t> key(std::min(a, b), std::max(a, b));
+            typename std::map<std::pair<std::uint32_t, std::uint32_t>, Label>::iterator
+                    s = sums.insert({key, Label()}).first;
+            s->second = s->second + *lbl;
+        }
+    }
+
+    for(const auto& s : sums)
+        res.addLblEdge(s.first.first, s.first.second, s.second);
+
+    return res;
+}
+
+
+#endif // UGRAPH_COMMUNITIES_HPP
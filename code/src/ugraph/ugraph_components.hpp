@@ -0,0 +1,234 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains implementations of parallel connected components
+///             algorithms for undirected graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UGRAPH_COMPONENTS_HPP
+#define UGRAPH_COMPONENTS_HPP
+
+#include <atomic>
+#include <limits>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "csr_ugraph.hpp"
+#include "par_utils.hpp"
+
+
+/// Result of a connected components search.
+template <typename VId>
+struct ConnectedComponents {
+    /// Dense component id for every vertex; components are numbered in order
+    /// of their first (smallest) vertex.
+    std::vector<VId> compIds;
+
+    /// Number of vertices in every component.
+    std::vector<size_t> compSizes;
+
+    size_t getComponentsNum() const { return compSizes.size(); }
+};
+
+
+/*! ****************************************************************************
+ *  \brief Lock-free concurrent union-find (disjoint set forest) over dense ids.
+ *
+ *  Links always hang the greater root under the smaller one by a CAS, so
+ *  concurrent unions never create cycles. No ranks are kept: the parallel
+ *  compress() pass flattens the trees at the end.
+ ******************************************************************************/
+template <typename VId>
+class ConcurrentDsu {
+public:
+    explicit ConcurrentDsu(size_t n)
+        : _parent(n)
+    {
+    }
+
+    /// Makes every element a singleton; runs in parallel.
+    void reset(unsigned threadsNum = 0)
+    {
+        par::parallelFor(_parent.size(), threadsNum, [this](size_t i, unsigned)
+        {
+            _parent[i].store(static_cast<VId>(i), std::memory_order_relaxed);
+        }, 1 << 14);
+    }
+
+    /// Merges sets of \a u and \a v; can be called from many threads.
+    void unite(VId u, VId v)
+    {
+        VId p1 = parent(u);
+        VId p2 = parent(v);
+        while(p1 != p2)
+        {
+            VId high = std::max(p1, p2);
+            VId low = std::min(p1, p2);
+            VId pHigh = parent(high);
+
+            // somebody has already linked it in the right way
+            if(pHigh == low)
+                break;
+
+            if(pHigh == high && _parent[high].compare_exchange_strong(
+                        pHigh, low, std::memory_order_relaxed))
+                break;
+
+            // climbs up one level on both sides and tries again
+            p1 = parent(parent(high));
+            p2 = parent(low);
+        }
+    }
+
+    /// Returns the representative of the set of \a v compressing the path
+    /// on the way; can be called from many threads.
+    VId find(VId v)
+    {
+        VId p = parent(v);
+        while(p != parent(p))
+        {
+            VId gp = parent(p);
+            _parent[v].store(gp, std::memory_order_relaxed);
+            v = p;
+            p = gp;
+        }
+
+        return p;
+    }
+
+    /// Makes every element point directly to its representative; runs in
+    /// parallel and must not overlap with unite().
+    void compress(unsigned threadsNum = 0)
+    {
+        par::parallelFor(_parent.size(), threadsNum, [this](size_t i, unsigned)
+        {
+            VId p = parent(static_cast<VId>(i));
+            while(p != parent(p))
+                p = parent(p);
+            _parent[i].store(p, std::memory_order_relaxed);
+        }, 1 << 14);
+    }
+
+    /// Returns the parent of \a v; after compress() it is the representative.
+    VId parent(VId v) const { return _parent[v].load(std::memory_order_relaxed); }
+
+    size_t size() const { return _parent.size(); }
+
+protected:
+    std::vector<std::atomic<VId>> _parent;
+}; // class ConcurrentDsu
+
+
+/// \brief Finds connected components of the graph \a g using the Afforest
+/// algorithm on \a threadsNum threads (0 means all hardware threads).
+///
+/// First \a neighbourRounds neighbours of every vertex are linked, which
+/// is usually enough to form the giant component. Then its id is estimated
+/// by sampling \a samplesNum vertices, and the rest of the edges is linked
+/// for the vertices that are out of the giant component only.
+///
+/// \tparam TGraph is a graph type with dense ids, such as CsrUGraph.
+template <typename TGraph>
+ConnectedComponents<typename TGraph::VId>
+    findComponentsAfforest(const TGraph& g, unsigned threadsNum = 0,
+                           unsigned neighbourRounds = 2,
+                           size_t samplesNum = 1024,
+                           unsigned seed = 5489u)
+{
+    typedef typename TGraph::VId VId;
+
+    const size_t n = g.getVerticesNum();
+    ConnectedComponents<VId> res;
+    if(n == 0)
+        return res;
+
+    ConcurrentDsu<VId> dsu(n);
+    dsu.reset(threadsNum);
+
+    // links the first neighbourRounds neighbours of every vertex
+    for(unsigned r = 0; r < neighbourRounds; ++r)
+    {
+        par::parallelFor(n, threadsNum, [&](size_t i, unsigned)
+        {
+            VId v = static_cast<VId>(i);
+            typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+            typename TGraph::AdjIter it = adj.first;
+            for(unsigned k = 0; k < r && it != adj.second; ++k)
+                ++it;
+
+            if(it != adj.second)
+                dsu.unite(v, *it);
+        });
+        dsu.compress(threadsNum);
+    }
+
+    // the most frequent representative among samples is the giant component
+    VId giant = 0;
+    {
+        std::mt19937 rnd(seed);
+        std::uniform_int_distribution<size_t> pick(0, n - 1);
+        std::unordered_map<VId, size_t> freqs;
+        size_t best = 0;
+        for(size_t s = 0; s < samplesNum; ++s)
+        {
+            VId c = dsu.parent(static_cast<VId>(pick(rnd)));
+            size_t f = ++freqs[c];
+            if(f > best)
+            {
+                best = f;
+                giant = c;
+            }
+        }
+    }
+
+    // finishes the rest of the edges, skipping the giant component: since the
+    // graph is undirected, its edges are seen from the other endpoints anyway
+    par::parallelFor(n, threadsNum, [&](size_t i, unsigned)
+    {
+        VId v = static_cast<VId>(i);
+        if(dsu.find(v) == giant)
+            return;
+
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+        typename TGraph::AdjIter it = adj.first;
+        for(unsigned k = 0; k < neighbourRounds && it != adj.second; ++k)
+            ++it;
+
+        for(; it != adj.second; ++it)
+            dsu.unite(v, *it);
+    }, 256);
+    dsu.compress(threadsNum);
+
+    // representatives are the smallest vertices of the components, so
+    // a single forward pass gives dense ids ordered by the first vertex
+    const VId none = std::numeric_limits<VId>::max();
+    res.compIds.assign(n, none);
+    for(size_t i = 0; i < n; ++i)
+    {
+        VId root = dsu.parent(static_cast<VId>(i));
+        if(root == i)
+        {
+            res.compIds[i] = static_cast<VId>(res.compSizes.size());
+            res.compSizes.push_back(0);
+        }
+
+        VId c = res.compIds[root];
+        res.compIds[i] = c;
+        ++res.compSizes[c];
+    }
+
+    return res;
+}
+
+
+#endif // UGRAPH_COMPONENTS_HPP
@@ -0,0 +1,248 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains implementations of k-core decomposition algorithms
+///             for undirected graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UGRAPH_KCORE_HPP
+#define UGRAPH_KCORE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "csr_ugraph.hpp"
+#include "par_utils.hpp"
+
+
+/// Result of a k-core decomposition.
+struct KCoreDecomposition {
+    /// Core number of every vertex by dense id.
+    std::vector<std::uint32_t> coreNums;
+
+    /// The maximum core number, i.e. the degeneracy of the graph.
+    std::uint32_t maxCore;
+
+    /// Dense ids in the order of peeling, i.e. the reversed smallest-last
+    /// order; filled by the sequential findCoreNumbers() only.
+    std::vector<std::uint32_t> peelOrder;
+};
+
+
+/// \brief Finds core numbers of all the vertices of the graph \a g by the
+/// Batagelj–Zaversnik algorithm in O(V + E).
+///
+/// Vertices are kept in an array sorted by their current degree using
+/// bucket boundaries, so removing the min-degree vertex and decreasing the
+/// degrees of its neighbours are O(1) each. Self-loops are ignored.
+///
+/// \tparam TGraph is a graph type with dense ids, such as CsrUGraph.
+template <typename TGraph>
+KCoreDecomposition findCoreNumbers(const TGraph& g)
+{
+    typedef typename TGraph::VId VId;
+
+    const size_t n = g.getVerticesNum();
+    KCoreDecomposition res;
+    res.coreNums.assign(n, 0);
+    res.maxCore = 0;
+    if(n == 0)
+        return res;
+
+    std::vector<std::uint32_t>& deg = res.coreNums;
+    std::uint32_t maxDeg = 0;
+    for(VId v = 0; v < n; ++v)
+    {
+        deg[v] = static_cast<std::uint32_t>(g.getDegree(v) - (g.hasSelfLoop(v) ? 1 : 0));
+        maxDeg = std::max(maxDeg, deg[v]);
+    }
+
+    // bin[d] is the beginning of the block of vertices of degree d in vert
+    std::vector<size_t> bin(maxDeg + 1, 0);
+    for(VId v = 0; v < n; ++v)
+        ++bin[deg[v]];
+    size_t start = 0;
+    for(std::uint32_t d = 0; d <= maxDeg; ++d)
+    {
+        size_t num = bin[d];
+        bin[d] = start;
+        start += num;
+    }
+
+    std::vector<VId> vert(n);
+    std::vector<size_t> pos(n);
+    for(VId v = 0; v < n; ++v)
+    {
+        pos[v] = bin[deg[v]]++;
+        vert[pos[v]] = v;
+    }
+    for(std::uint32_t d = maxDeg; d > 0; --d)
+        bin[d] = bin[d - 1];
+    bin[0] = 0;
+
+    // peels vertices in order of the current degree
+    for(size_t i = 0; i < n; ++i)
+    {
+        VId v = vert[i];
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+        for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+        {
+            VId u = *it;
+            if(deg[u] <= deg[v])
+                continue;                       // also skips a self-loop
+
+            // moves u to the beginning of its block and shrinks the block
+            std::uint32_t du = deg[u];
+            size_t pu = pos[u];
+            size_t pw = bin[du];
+            VId w = vert[pw];
+            if(u != w)
+            {
+                pos[u] = pw;
+                vert[pu] = w;
+                pos[w] = pu;
+                vert[pw] = u;
+            }
+            ++bin[du];
+            --deg[u];
+        }
+    }
+
+    res.maxCore = *std::max_element(deg.begin(), deg.end());
+    res.peelOrder.assign(vert.begin(), vert.end());
+    return res;
+}
+
+
+/// \brief Finds core numbers of all the vertices of the graph \a g by parallel
+/// peeling in level-synchronous rounds on \a threadsNum threads.
+///
+/// For k = 0, 1, ... all the vertices of degree at most k are removed in
+/// rounds; a round decrements the degrees of the neighbours of the removed
+/// vertices atomically, and those dropping to k form the next round.
+template <typename TGraph>
+KCoreDecomposition findCoreNumbersParallel(const TGraph& g,
+                                           unsigned threadsNum = 0)
+{
+    typedef typename TGraph::VId VId;
+
+    const size_t n = g.getVerticesNum();
+    threadsNum = par::getThreadsNum(threadsNum);
+
+    KCoreDecomposition res;
+    res.coreNums.assign(n, 0);
+    res.maxCore = 0;
+
+    std::vector<std::atomic<std::uint32_t>> deg(n);
+    std::vector<char> removed(n, 0);
+    par::parallelFor(n, threadsNum, [&](size_t i, unsigned)
+    {
+        VId v = static_cast<VId>(i);
+        std::uint32_t d = static_cast<std::uint32_t>(
+                    g.getDegree(v) - (g.hasSelfLoop(v) ? 1 : 0));
+        deg[v].store(d, std::memory_order_relaxed);
+    }, 1 << 12);
+
+    std::vector<std::vector<VId>> localNext(threadsNum);
+    std::vector<VId> frontier;
+    auto gather = [&]()
+    {
+        frontier.clear();
+        for(std::vector<VId>& ln : localNext)
+        {
+            frontier.insert(frontier.end(), ln.begin(), ln.end());
+            ln.clear();
+        }
+    };
+
+    size_t remaining = n;
+    std::uint32_t k = 0;
+    while(remaining > 0)
+    {
+        // starts the level with all the remaining vertices of degree <= k
+        par::parallelFor(n, threadsNum, [&](size_t i, unsigned tid)
+        {
+            if(!removed[i] && deg[i].load(std::memory_order_relaxed) <= k)
+                localNext[tid].push_back(static_cast<VId>(i));
+        }, 1 << 12);
+        gather();
+
+        while(!frontier.empty())
+        {
+            for(VId v : frontier)
+            {
+                removed[v] = 1;
+                res.coreNums[v] = k;
+            }
+            remaining -= frontier.size();
+
+            par::parallelFor(frontier.size(), threadsNum, [&](size_t i, unsigned tid)
+            {
+                VId v = frontier[i];
+                typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+                for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+                {
+                    VId u = *it;
+                    if(removed[u])
+                        continue;               // also skips a self-loop
+
+                    // exactly one thread sees the degree crossing k + 1 -> k
+                    if(deg[u].fetch_sub(1, std::memory_order_relaxed) == k + 1)
+                        localNext[tid].push_back(u);
+                }
+            }, 64);
+            gather();
+        }
+
+        // jumps straight to the smallest remaining degree, which is > k
+        std::uint32_t minDeg = std::numeric_limits<std::uint32_t>::max();
+        for(size_t i = 0; i < n; ++i)
+            if(!removed[i])
+                minDeg = std::min(minDeg, deg[i].load(std::memory_order_relaxed));
+        k = minDeg;
+    }
+
+    if(n > 0)
+        res.maxCore = *std::max_element(res.coreNums.begin(), res.coreNums.end());
+    return res;
+}
+
+
+/// Returns the subgraph of \a g induced by the vertices of the maximum core
+/// of the decomposition \a kcd.
+template <typename Vertex>
+UGraph<Vertex> getMaxCoreSubgraph(const CsrUGraph<Vertex>& g,
+                                  const KCoreDecomposition& kcd)
+{
+    typedef typename CsrUGraph<Vertex>::VId VId;
+
+    UGraph<Vertex> res;
+    for(VId v = 0; v < g.getVerticesNum(); ++v)
+    {
+        if(kcd.coreNums[v] != kcd.maxCore)
+            continue;
+
+        res.addVertex(g.getVertex(v));
+        typename CsrUGraph<Vertex>::AdjIterPair adj = g.getAdjVertices(v);
+        for(auto it = adj.first; it != adj.second; ++it)
+            if(*it >= v && kcd.coreNums[*it] == kcd.maxCore)
+                res.addEdge(g.getVertex(v), g.getVertex(*it));
+    }
+
+    return res;
+}
+
+
+#endif // UGRAPH_KCORE_HPP
@@ -0,0 +1,431 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains implementations of global minimum cut algorithms for
+///             labeled undirected graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UGRAPH_MINCUT_HPP
+#define UGRAPH_MINCUT_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "bit_utils.hpp"
+#include "csr_lbl_ugraph.hpp"
+#include "par_utils.hpp"
+
+
+/// Result of a minimum cut search.
+template <typename Weight>
+struct GraphCut {
+    /// Total label (capacity) of the edges crossing the cut.
+    Weight value;
+
+    /// Side of every vertex by dense id; the cut separates true from false.
+    std::vector<bool> side;
+};
+
+
+namespace mincut_details {
+
+/// Throws if the graph \a g cannot be cut or has a negative capacity.
+template <typename TGraph>
+void checkGraph(const TGraph& g)
+{
+    typedef typename TGraph::VId VId;
+
+    if(g.getVerticesNum() < 2)
+        throw std::invalid_argument("A cut needs at least two vertices");
+
+    for(VId v = 0; v < g.getVerticesNum(); ++v)
+        for(size_t i = 0; i < g.getDegree(v); ++i)
+            if(g.getAdjLabels(v)[i] < typename TGraph::Label())
+                throw std::invalid_argument("Negative edge capacity for a cut");
+}
+
+} // namespace mincut_details
+
+
+/// \brief Finds a global minimum cut of the graph \a g with edge labels as
+/// capacities by the Stoer–Wagner algorithm in O(VE + V^2 log V).
+///
+/// Every phase builds a maximum adjacency ordering with a binary heap
+/// (with lazy deletion), takes the cut of the phase around the last vertex,
+/// and merges the two last vertices. Capacities must be non-negative;
+/// self-loops are ignored.
+///
+/// \tparam TGraph is a labeled graph type with dense ids, such as
+/// CsrEdgeLblUGraph.
+template <typename TGraph>
+GraphCut<typename TGraph::Label> findMinCutStoerWagner(const TGraph& g)
+{
+    typedef typename TGraph::VId VId;
+    typedef typename TGraph::Label Weight;
+    typedef std::unordered_map<VId, Weight> Adj;
+    typedef std::pair<Weight, VId> HeapEntry;
+
+    mincut_details::checkGraph(g);
+
+    const size_t n = g.getVerticesNum();
+    std::vector<Adj> adj(n);
+    for(VId v = 0; v < n; ++v)
+    {
+        typename TGraph::AdjIterPair vs = g.getAdjVertices(v);
+        typename TGraph::AdjLblIter lbl = g.getAdjLabels(v);
+        for(typename TGraph::AdjIter it = vs.first; it != vs.second; ++it, ++lbl)
+            if(*it != v)
+                adj[v][*it] = *lbl;
+    }
+
+    // original vertices merged into every super-vertex
+    std::vector<std::vector<VId>> members(n);
+    std::vector<VId> active(n);
+    for(VId v = 0; v < n; ++v)
+    {
+        members[v].push_back(v);
+        active[v] = v;
+    }
+
+    GraphCut<Weight> res;
+    bool found = false;
+    std::vector<Weight> key(n);
+    std::vector<char> added(n);
+
+    while(active.size() > 1)
+    {
+        // maximum adjacency ordering
+        std::priority_queue<HeapEntry> heap;
+        for(VId v : active)
+        {
+            key[v] = Weight();
+            added[v] = 0;
+            heap.push({Weight(), v});
+        }
+
+        VId prev = active[0], last = active[0];
+        for(size_t left = active.size(); left > 0; )
+        {
+            HeapEntry top = heap.top();
+            heap.pop();
+            VId v = top.second;
+            if(added[v] || top.first < key[v])
+                continue;                       // outdated entry
+
+            added[v] = 1;
+            --left;
+            prev = last;
+            last = v;
+            for(const typename Adj::value_type& uw : adj[v])
+                if(!added[uw.first])
+                {
+                    key[uw.first] += uw.second;
+                    heap.push({key[uw.first], uw.first});
+                }
+        }
+
+        // the cut of the phase separates the last vertex
+        if(!found || key[last] < res.value)
+        {
+            found = true;
+            res.value = key[last];
+            res.side.assign(n, false);
+            for(VId v : members[last])
+                res.side[v] = true;
+        }
+
+        // merges the last vertex into the previous one
+        for(const typename Adj::value_type& uw : adj[last])
+        {
+            VId u = uw.first;
+            adj[u].erase(last);
+            if(u == prev)
+                continue;
+
+            adj[prev][u] += uw.second;
+            adj[u][prev] += uw.second;
+        }
+        adj[last].clear();
+        members[prev].insert(members[prev].end(), members[last].begin(),
+                             members[last].end());
+        members[last].clear();
+        active.erase(std::find(active.begin(), active.end(), last));
+    }
+
+    return res;
+}
+
+
+namespace mincut_details {
+
+/// Weighted edge of a multigraph being contracted.
+template <typename VId, typename Weight>
+struct WEdge {
+    VId a, b;
+    Weight w;
+};
+
+/*! ****************************************************************************
+ *  \brief A single recursive Karger–Stein trial.
+ ******************************************************************************/
+template <typename VId, typename Weight>
+class KargerStein {
+public:
+    typedef std::vector<WEdge<VId, Weight>> Edges;
+
+    explicit KargerStein(std::uint64_t seed)
+        : _rnd(seed)
+    {
+    }
+
+    /// Finds a cut of the multigraph of \a k vertices and \a edges; returns
+    /// its value and assigns sides of the vertices to \a side.
+    Weight run(const Edges& edges, VId k, std::vector<bool>& side)
+    {
+        if(k <= 6)
+            return bruteForce(edges, k, side);
+
+        VId target = static_cast<VId>(std::ceil(1.0 + k / std::sqrt(2.0)));
+        Weight best = Weight();
+        for(int rep = 0; rep < 2; ++rep)
+        {
+            std::vector<VId> map;
+            Edges contracted;
+            VId k2 = contract(edges, k, target, map, contracted);
+
+            std::vector<bool> side2;
+            Weight val;
+            if(contracted.empty())
+            {
+                // nothing connects the rest: a zero cut around one part
+                val = Weight();
+                side2.assign(k2, false);
+                side2[0] = true;
+            }
+            else
+                val = run(contracted, k2, side2);
+
+            if(rep == 0 || val < best)
+            {
+                best = val;
+                side.resize(k);
+                for(VId v = 0; v < k; ++v)
+                    side[v] = side2[map[v]];
+            }
+        }
+
+        return best;
+    }
+
+protected:
+    /// Contracts random edges, with probability proportional to their
+    /// weights, until \a target vertices remain (or no edges remain).
+    VId contract(const Edges& edges, VId k, VId target,
+                 std::vector<VId>& map, Edges& out)
+    {
+        // exponential clocks: a heavier edge tends to fire earlier
+        std::uniform_real_distribution<double> uni(0.0, 1.0);
+        std::vector<std::pair<double, size_t>> order(edges.size());
+        for(size_t i = 0; i < edges.size(); ++i)
+        {
+            double w = static_cast<double>(edges[i].w);
+            double u = 1.0 - uni(_rnd);         // (0, 1]
+            order[i] = { w > 0 ? -std::log(u) / w : HUGE_VAL, i };
+        }
+        std::sort(order.begin(), order.end());
+
+        std::vector<VId> parent(k);
+        for(VId v = 0; v < k; ++v)
+            parent[v] = v;
+        auto find = [&parent](VId v)
+        {
+            while(parent[v] != v)
+                v = parent[v] = parent[parent[v]];
+            return v;
+        };
+
+        VId left = k;
+        for(size_t i = 0; i < order.size() && left > target; ++i)
+        {
+            const WEdge<VId, Weight>& e = edges[order[i].second];
+            VId ra = find(e.a), rb = find(e.b);
+            if(ra != rb)
+            {
+                parent[ra] = rb;
+                --left;
+            }
+        }
+
+        // relabels the super-vertices densely
+        const VId none = std::numeric_limits<VId>::max();
+        std::vector<VId> ids(k, none);
+        map.resize(k);
+        VId k2 = 0;
+        for(VId v = 0; v < k; ++v)
+        {
+            VId r = find(v);
+            if(ids[r] == none)
+                ids[r] = k2++;
+            map[v] = ids[r];
+        }
+
+        // drops inner edges and merges parallel ones, so the multigraph
+        // never has more than k2^2 / 2 edges
+        out.clear();
+        for(const WEdge<VId, Weight>& e : edges)
+        {
+            VId a = map[e.a], b = map[e.b];
+            if(a != b)
+                out.push_back({std::min(a, b), std::max(a, b), e.w});
+        }
+        std::sort(out.begin(), out.end(),
+                  [](const WEdge<VId, Weight>& x, const WEdge<VId, Weight>& y)
+        {
+            return x.a < y.a || (x.a == y.a && x.b < y.b);
+        });
+
+        size_t kept = 0;
+        for(size_t i = 0; i < out.size(); ++i)
+        {
+            if(kept > 0 && out[kept - 1].a == out[i].a && out[kept - 1].b == out[i].b)
+                out[kept - 1].w += out[i].w;
+            else
+                out[kept++] = out[i];
+        }
+        out.resize(kept);
+
+        return k2;
+    }
+
+    /// Tries all the cuts of a small multigraph.
+    static Weight bruteForce(const Edges& edges, VId k, std::vector<bool>& side)
+    {
+        Weight best = Weight();
+        unsigned bestMask = 1;
+        for(unsigned mask = 1; mask < (1u << (k - 1)); ++mask)
+        {
+            Weight val = Weight();
+            for(const WEdge<VId, Weight>& e : edges)
+                if(((mask >> e.a) & 1) != ((mask >> e.b) & 1))
+                    val += e.w;
+
+            if(mask == 1 || val < best)
+            {
+                best = val;
+                bestMask = mask;
+            }
+        }
+
+        side.resize(k);
+        for(VId v = 0; v < k; ++v)
+            side[v] = ((bestMask >> v) & 1) != 0;
+
+        return best;
+    }
+
+protected:
+    std::mt19937_64 _rnd;
+}; // class KargerStein
+
+} // namespace mincut_details
+
+
+/// \brief Finds a global minimum cut of the graph \a g with edge labels as
+/// capacities by \a trialsNum independent Karger–Stein trials run on
+/// \a threadsNum threads.
+///
+/// Every trial finds a minimum cut with probability Omega(1 / log V), so
+/// O(log^2 V) trials (used if \a trialsNum is 0) give a high probability of
+/// success. Trials stop early as soon as a cut of value \a stopAtValue or
+/// less is known. The cut around a vertex of the minimum weighted degree
+/// is taken as the initial candidate. Capacities must be non-negative;
+/// self-loops are ignored.
+template <typename TGraph>
+GraphCut<typename TGraph::Label>
+    findMinCutKargerStein(const TGraph& g, size_t trialsNum = 0,
+                          unsigned threadsNum = 0,
+                          typename TGraph::Label stopAtValue = typename TGraph::Label(),
+                          unsigned seed = 5489u)
+{
+    typedef typename TGraph::VId VId;
+    typedef typename TGraph::Label Weight;
+    typedef mincut_details::KargerStein<VId, Weight> Trial;
+
+    mincut_details::checkGraph(g);
+
+    const size_t n = g.getVerticesNum();
+    typename Trial::Edges edges;
+    GraphCut<Weight> best;
+    best.side.assign(n, false);
+    for(VId v = 0; v < n; ++v)
+    {
+        Weight wdeg = Weight();
+        typename TGraph::AdjIterPair vs = g.getAdjVertices(v);
+        typename TGraph::AdjLblIter lbl = g.getAdjLabels(v);
+        for(typename TGraph::AdjIter it = vs.first; it != vs.second; ++it, ++lbl)
+        {
+            if(*it == v)
+                continue;
+            wdeg += *lbl;
+            if(v < *it)
+                edges.push_back({v, *it, *lbl});
+        }
+
+        if(v == 0 || wdeg < best.value)
+        {
+            best.value = wdeg;
+            std::fill(best.side.begin(), best.side.end(), false);
+            best.side[v] = true;
+        }
+    }
+
+    if(trialsNum == 0)
+    {
+        double lg = std::log2(static_cast<double>(n));
+        trialsNum = static_cast<size_t>(std::ceil(lg * lg)) + 1;
+    }
+
+    std::mutex bestMutex;
+    std::atomic<bool> done(!(stopAtValue < best.value));
+    par::parallelFor(trialsNum, threadsNum, [&](size_t t, unsigned)
+    {
+        if(done.load(std::memory_order_relaxed))
+            return;
+
+        Trial trial(bits::mix64(seed ^ bits::mix64(t)));
+        std::vector<bool> side;
+        Weight val = trial.run(edges, static_cast<VId>(n), side);
+
+        std::lock_guard<std::mutex> lock(bestMutex);
+        if(val < best.value)
+        {
+            best.value = val;
+            best.side.swap(side);
+            if(!(stopAtValue < val))
+                done.store(true, std::memory_order_relaxed);
+        }
+    }, 1);
+
+    return best;
+}
+
+
+#endif // UGRAPH_MINCUT_HPP
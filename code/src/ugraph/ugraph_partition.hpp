@@ -0,0 +1,996 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains partitioning of graphs into k balanced parts with few
+///             cut edges, and the subgraphs of the parts.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+/// Partitioners take a graph with dense ids, such as a CsrEdgeLblUGraph made
+/// of an EdgeLblUGraph, and return a part id per vertex:
+///
+///     CsrEdgeLblUGraph<int, double> csr(g);
+///     GraphPartition p = partitionGraphMultilevel(csr, 8);
+///     auto parts = makeGraphParts(csr, p);      // one subgraph per worker
+///
+/// A subgraph holds the vertices of its part followed by their neighbours
+/// owned by other parts, the ghosts, whose owners are kept in its table.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UGRAPH_PARTITION_HPP
+#define UGRAPH_PARTITION_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "csr_lbl_ugraph.hpp"
+#include "par_utils.hpp"
+
+
+/// Partition of the vertices of a graph into parts.
+struct GraphPartition {
+    /// Part ids 0..partsNum-1 of the vertices by dense ids.
+    std::vector<std::uint32_t> partIds;
+
+    /// Number of parts, some of which may be empty.
+    std::uint32_t partsNum;
+
+    /// Numbers of vertices by parts.
+    std::vector<size_t> partSizes;
+
+    /// Number of edges between different parts.
+    size_t cutEdges;
+};
+
+
+/// \brief Returns the number of edges of \a g between the vertices of
+/// different parts given by \a partIds.
+template <typename TGraph>
+size_t getCutEdgesNum(const TGraph& g, const std::vector<std::uint32_t>& partIds)
+{
+    typedef typename TGraph::VId VId;
+
+    size_t cut = 0;
+    for(VId v = 0; v < g.getVerticesNum(); ++v)
+    {
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+        for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+            if(*it > v && partIds[*it] != partIds[v])
+                ++cut;
+    }
+
+    return cut;
+}
+
+
+namespace partition_details {
+
+const std::uint32_t NONE = static_cast<std::uint32_t>(-1);
+
+/// Completes a partition by the sizes of the parts and the cut.
+template <typename TGraph>
+GraphPartition makePartition(const TGraph& g, std::vector<std::uint32_t>&& partIds,
+                             std::uint32_t partsNum)
+{
+    GraphPartition p;
+    p.partIds = std::move(partIds);
+    p.partsNum = partsNum;
+    p.partSizes.assign(partsNum, 0);
+    for(std::uint32_t part : p.partIds)
+        ++p.partSizes[part];
+    p.cutEdges = getCutEdgesNum(g, p.partIds);
+
+    return p;
+}
+
+/// \brief Weighted graph of a coarsening level without self-loops: a vertex
+/// weighs the number of the original vertices it stands for, an edge the
+/// number of the original edges.
+struct LevelGraph {
+    std::vector<size_t> offsets;
+    std::vector<std::uint32_t> adj;
+    std::vector<std::uint64_t> weights;     ///< Edge weights parallel to adj.
+    std::vector<std::uint64_t> vweights;
+
+    size_t getVerticesNum() const { return vweights.size(); }
+};
+
+/// The finest level: \a g with unit weights.
+template <typename TGraph>
+LevelGraph makeLevelGraph(const TGraph& g)
+{
+    typedef typename TGraph::VId VId;
+    const size_t n = g.getVerticesNum();
+
+    LevelGraph lg;
+    lg.offsets.reserve(n + 1);
+    lg.offsets.push_back(0);
+    for(VId v = 0; v < n; ++v)
+    {
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+        for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+            if(*it != v)
+                lg.adj.push_back(*it);
+        lg.offsets.push_back(lg.adj.size());
+    }
+    lg.weights.assign(lg.adj.size(), 1);
+    lg.vweights.assign(n, 1);
+
+    return lg;
+}
+
+/// \brief Matches vertices visited in a random order with their unmatched
+/// neighbours by the heaviest edges, keeping the matched pairs not heavier
+/// than \a maxVWeight.
+///
+/// \return coarse vertex ids by the vertices; their number in \a coarseNum.
+inline std::vector<std::uint32_t> matchHeavyEdges(const LevelGraph& lg,
+                                                  std::uint64_t maxVWeight,
+                                                  std::mt19937& rnd,
+                                                  std::uint32_t& coarseNum)
+{
+    const size_t n = lg.getVerticesNum();
+    std::vector<std::uint32_t> order(n), match(n, NONE);
+    for(size_t v = 0; v < n; ++v)
+        order[v] = static_cast<std::uint32_t>(v);
+    std::shuffle(order.begin(), order.end(), rnd);
+
+    for(std::uint32_t v : order)
+    {
+        if(match[v] != NONE)
+            continue;
+
+        std::uint32_t best = v;
+        std::uint64_t bestW = 0;
+        for(size_t i = lg.offsets[v]; i < lg.offsets[v + 1]; ++i)
+        {
+            std::uint32_t u = lg.adj[i];
+            if(match[u] != NONE || lg.vweights[v] + lg.vweights[u] > maxVWeight)
+                continue;
+            if(lg.weights[i] > bestW
+                || (lg.weights[i] == bestW && lg.vweights[u] < lg.vweights[best]))
+            {
+                best = u;
+                bestW = lg.weights[i];
+            }
+        }
+        match[v] = best;
+        match[best] = v;
+    }
+
+    std::vector<std::uint32_t> cmap(n, NONE);
+    coarseNum = 0;
+    for(size_t v = 0; v < n; ++v)
+        if(cmap[v] == NONE)
+        {
+            cmap[v] = cmap[match[v]] = coarseNum;
+            ++coarseNum;
+        }
+
+    return cmap;
+}
+
+/// Collapses the vertices of \a lg by the coarse ids \a cmap, summing the
+/// weights of the merged vertices and parallel edges.
+inline LevelGraph contract(const LevelGraph& lg, const std::vector<std::uint32_t>& cmap,
+                           std::uint32_t coarseNum)
+{
+    const size_t n = lg.getVerticesNum();
+
+    // vertices grouped by the coarse ones
+    std::vector<size_t> starts(coarseNum + 1, 0);
+    for(std::uint32_t c : cmap)
+        ++starts[c + 1];
+    for(std::uint32_t c = 0; c < coarseNum; ++c)
+        starts[c + 1] += starts[c];
+    std::vector<std::uint32_t> members(n);
+    std::vector<size_t> fill(starts.begin(), starts.end() - 1);
+    for(size_t v = 0; v < n; ++v)
+        members[fill[cmap[v]]++] = static_cast<std::uint32_t>(v);
+
+    LevelGraph cg;
+    cg.offsets.reserve(coarseNum + 1);
+    cg.offsets.push_back(0);
+    cg.vweights.assign(coarseNum, 0);
+    std::vector<std::uint64_t> sums(coarseNum, 0);
+    std::vector<std::uint32_t> touched;
+    for(std::uint32_t c = 0; c < coarseNum; ++c)
+    {
+        for(size_t j = starts[c]; j < starts[c + 1]; ++j)
+        {
+            std::uint32_t v = members[j];
+            cg.vweights[c] += lg.vweights[v];
+            for(size_t i = lg.offsets[v]; i < lg.offsets[v + 1]; ++i)
+            {
+                std::uint32_t cu = cmap[lg.adj[i]];
+                if(cu == c)
+                    continue;
+                if(sums[cu] == 0)
+                    touched.push_back(cu);
+                sums[cu] += lg.weights[i];
+            }
+        }
+
+        for(std::uint32_t cu : touched)
+        {
+            cg.adj.push_back(cu);
+            cg.weights.push_back(sums[cu]);
+            sums[cu] = 0;
+        }
+        touched.clear();
+        cg.offsets.push_back(cg.adj.size());
+    }
+
+    return cg;
+}
+
+/*! ****************************************************************************
+ *  \brief Boundary refinement of a k-way partition of a level graph by the
+ *  Fiduccia-Mattheyses heuristic.
+ *
+ *  A pass moves the boundary vertices one by one, each to the adjacent part
+ *  with room that gains most, even when the gain is negative, so that the
+ *  pass can climb out of a local minimum; a vertex moves once per pass. The
+ *  moves after the best cut seen are rolled back.
+ ******************************************************************************/
+class Refiner {
+public:
+    Refiner(const LevelGraph& lg, std::uint32_t partsNum, std::uint64_t maxPartWeight,
+            std::vector<std::uint32_t>& parts)
+        : _lg(lg), _parts(parts), _maxW(maxPartWeight), _partW(partsNum, 0),
+          _conn(partsNum, 0)
+    {
+        for(size_t v = 0; v < parts.size(); ++v)
+            _partW[parts[v]] += lg.vweights[v];
+    }
+
+    /// Moves vertices out of the parts heavier than the limit, cheapest
+    /// first, as long as other parts have room.
+    void rebalance()
+    {
+        const std::uint32_t k = static_cast<std::uint32_t>(_partW.size());
+        for(std::uint32_t p = 0; p < k; ++p)
+        {
+            if(_partW[p] <= _maxW)
+                continue;
+
+            std::vector<std::pair<std::int64_t, std::uint32_t>> cands;
+            for(size_t v = 0; v < _parts.size(); ++v)
+                if(_parts[v] == p)
+                {
+                    std::uint32_t to;
+                    std::int64_t gain;
+                    findMove(static_cast<std::uint32_t>(v), true, to, gain);
+                    cands.push_back({gain, static_cast<std::uint32_t>(v)});
+                }
+            std::stable_sort(cands.begin(), cands.end(),
+                             [](const std::pair<std::int64_t, std::uint32_t>& a,
+                                const std::pair<std::int64_t, std::uint32_t>& b)
+            {
+                return a.first > b.first;
+            });
+
+            for(size_t i = 0; i < cands.size() && _partW[p] > _maxW; ++i)
+            {
+                std::uint32_t to;
+                std::int64_t gain;
+                if(findMove(cands[i].second, true, to, gain))
+                    move(cands[i].second, to);
+            }
+        }
+    }
+
+    /// Runs FM passes until one brings no gain, at most \a maxPasses.
+    void refine(unsigned maxPasses = 8)
+    {
+        for(unsigned i = 0; i < maxPasses && runPass() > 0; ++i)
+            ;
+    }
+
+protected:
+    /// \brief Finds the best move of \a v to an adjacent part with room, or to
+    /// any one with room if \a any.
+    ///
+    /// \return false if there is no such part.
+    bool findMove(std::uint32_t v, bool any, std::uint32_t& to, std::int64_t& gain)
+    {
+        const LevelGraph& lg = _lg;
+        const std::uint32_t own = _parts[v];
+        for(size_t i = lg.offsets[v]; i < lg.offsets[v + 1]; ++i)
+        {
+            std::uint32_t p = _parts[lg.adj[i]];
+            if(_conn[p] == 0)
+                _touched.push_back(p);
+            _conn[p] += static_cast<std::int64_t>(lg.weights[i]);
+        }
+
+        const std::int64_t internal = _conn[own];
+        to = NONE;
+        for(std::uint32_t p : _touched)
+            if(p != own && _partW[p] + lg.vweights[v] <= _maxW
+                && (to == NONE || _conn[p] > _conn[to]
+                    || (_conn[p] == _conn[to] && _partW[p] < _partW[to])))
+                to = p;
+        if(to == NONE && any)
+            for(std::uint32_t p = 0; p < _partW.size(); ++p)
+                if(p != own && _partW[p] + lg.vweights[v] <= _maxW
+                    && (to == NONE || _partW[p] < _partW[to]))
+                    to = p;
+        gain = to == NONE ? 0 : _conn[to] - internal;
+
+        for(std::uint32_t p : _touched)
+            _conn[p] = 0;
+        _touched.clear();
+
+        return to != NONE;
+    }
+
+    void move(std::uint32_t v, std::uint32_t to)
+    {
+        _partW[_parts[v]] -= _lg.vweights[v];
+        _partW[to] += _lg.vweights[v];
+        _parts[v] = to;
+    }
+
+    /// Returns the decrease of the cut weight.
+    std::int64_t runPass()
+    {
+        typedef std::pair<std::int64_t, std::uint32_t> Entry;
+        const LevelGraph& lg = _lg;
+        const size_t n = lg.getVerticesNum();
+
+        // gains are recomputed when popped: the stale ones are pushed anew
+        std::priority_queue<Entry> heap;
+        for(size_t v = 0; v < n; ++v)
+            for(size_t i = lg.offsets[v]; i < lg.offsets[v + 1]; ++i)
+                if(_parts[lg.adj[i]] != _parts[v])
+                {
+                    std::uint32_t to;
+                    std::int64_t gain;
+                    if(findMove(static_cast<std::uint32_t>(v), false, to, gain))
+                        heap.push({gain, static_cast<std::uint32_t>(v)});
+                    break;
+                }
+
+        const size_t patience = std::max<size_t>(50, n / 100);
+        std::vector<bool> locked(n, false);
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> moves;     // vertex, from
+        std::int64_t total = 0, best = 0;
+        size_t bestNum = 0;
+        while(!heap.empty() && moves.size() - bestNum <= patience)
+        {
+            Entry e = heap.top();
+            heap.pop();
+            std::uint32_t v = e.second, to;
+            std::int64_t gain;
+            if(locked[v] || !findMove(v, false, to, gain))
+                continue;
+            if(gain != e.first)
+            {
+                heap.push({gain, v});
+                continue;
+            }
+
+            moves.push_back({v, _parts[v]});
+            move(v, to);
+            locked[v] = true;
+            total += gain;
+            if(total > best)
+            {
+                best = total;
+                bestNum = moves.size();
+            }
+
+            for(size_t i = lg.offsets[v]; i < lg.offsets[v + 1]; ++i)
+            {
+                std::uint32_t u = lg.adj[i];
+                if(!locked[u] && findMove(u, false, to, gain))
+                    heap.push({gain, u});
+            }
+        }
+
+        while(moves.size() > bestNum)
+        {
+            move(moves.back().first, moves.back().second);
+            moves.pop_back();
+        }
+
+        return best;
+    }
+
+protected:
+    const LevelGraph& _lg;
+    std::vector<std::uint32_t>& _parts;
+    std::uint64_t _maxW;                    ///< Limit of part weights.
+    std::vector<std::uint64_t> _partW;
+    std::vector<std::int64_t> _conn;        ///< Weights of the edges by parts.
+    std::vector<std::uint32_t> _touched;    ///< Parts with nonzero _conn.
+}; // class Refiner
+
+/// \brief Greedy graph growing: the parts are grown one by one by BFS from a
+/// random seed, taking the vertex most connected to the part next, until
+/// the part gets its share of the weight left; the last part takes the rest.
+inline std::vector<std::uint32_t> growParts(const LevelGraph& lg, std::uint32_t partsNum,
+                                            std::mt19937& rnd)
+{
+    typedef std::pair<std::uint64_t, std::uint32_t> Entry;
+    const size_t n = lg.getVerticesNum();
+
+    std::vector<std::uint32_t> parts(n, NONE), seeds(n);
+    for(size_t v = 0; v < n; ++v)
+        seeds[v] = static_cast<std::uint32_t>(v);
+    std::shuffle(seeds.begin(), seeds.end(), rnd);
+    size_t nextSeed = 0;
+
+    std::uint64_t left = 0;
+    for(std::uint64_t w : lg.vweights)
+        left += w;
+
+    std::vector<std::uint64_t> conn(n, 0);
+    for(std::uint32_t p = 0; p + 1 < partsNum; ++p)
+    {
+        const std::uint64_t target = left / (partsNum - p);
+        std::uint64_t weight = 0;
+        std::priority_queue<Entry> heap;
+        std::vector<std::uint32_t> touched;
+        while(weight < target)
+        {
+            if(heap.empty())
+            {
+                while(nextSeed < n && parts[seeds[nextSeed]] != NONE)
+                    ++nextSeed;
+                if(nextSeed == n)
+                    break;
+                heap.push({0, seeds[nextSeed]});
+            }
+
+            Entry e = heap.top();
+            heap.pop();
+            std::uint32_t v = e.second;
+            if(parts[v] != NONE || e.first != conn[v])
+                continue;
+
+            parts[v] = p;
+            weight += lg.vweights[v];
+            for(size_t i = lg.offsets[v]; i < lg.offsets[v + 1]; ++i)
+            {
+                std::uint32_t u = lg.adj[i];
+                if(parts[u] != NONE)
+                    continue;
+                if(conn[u] == 0)
+                    touched.push_back(u);
+                conn[u] += lg.weights[i];
+                heap.push({conn[u], u});
+            }
+        }
+
+        for(std::uint32_t u : touched)
+            conn[u] = 0;
+        left -= weight;
+    }
+
+    for(std::uint32_t& p : parts)
+        if(p == NONE)
+            p = partsNum - 1;
+
+    return parts;
+}
+
+/// Returns the total weight of the edges of \a lg between different parts.
+inline std::uint64_t getCutWeight(const LevelGraph& lg, const std::vector<std::uint32_t>& parts)
+{
+    std::uint64_t cut = 0;
+    for(size_t v = 0; v < lg.getVerticesNum(); ++v)
+        for(size_t i = lg.offsets[v]; i < lg.offsets[v + 1]; ++i)
+            if(parts[lg.adj[i]] != parts[v])
+                cut += lg.weights[i];
+
+    return cut / 2;
+}
+
+} // namespace partition_details
+
+
+/*! ****************************************************************************
+ *  \brief Partitions the graph \a g into \a partsNum parts of at most
+ *  (1 + \a imbalance)·n/k vertices each (rounded up), minimizing the number
+ *  of cut edges by the multilevel scheme of METIS.
+ *
+ *  The graph is coarsened by heavy-edge matching down to a few dozen
+ *  vertices per part; the coarsest graph is partitioned by greedy graph
+ *  growing from several random seeds, keeping the best try; the partition is
+ *  projected back level by level and refined by k-way Fiduccia-Mattheyses
+ *  on each one. Coarse levels may exceed the balance limit by the weight of
+ *  their heaviest vertex; the finest one is rebalanced to the exact limit.
+ *
+ *  Self-loops are ignored; edge labels, if any, are not used as weights.
+ *
+ *  \tparam TGraph is a graph type with dense ids, such as CsrEdgeLblUGraph.
+ *  \param seed seeds the random matchings and growing seeds, so that the
+ *  result is deterministic.
+ ******************************************************************************/
+template <typename TGraph>
+GraphPartition partitionGraphMultilevel(const TGraph& g, std::uint32_t partsNum,
+                                        double imbalance = 0.03, unsigned seed = 5489u)
+{
+    using namespace partition_details;
+
+    if(partsNum == 0)
+        throw std::invalid_argument("The number of parts must be positive");
+    if(imbalance < 0)
+        throw std::invalid_argument("The imbalance must be nonnegative");
+
+    const size_t n = g.getVerticesNum();
+    if(partsNum == 1 || n == 0)
+        return makePartition(g, std::vector<std::uint32_t>(n, 0), partsNum);
+
+    std::mt19937 rnd(seed);
+    const std::uint64_t maxW = static_cast<std::uint64_t>(
+            std::ceil((1 + imbalance) * static_cast<double>(n) / partsNum));
+
+    // coarsening
+    const size_t coarsenTo = std::max<size_t>(100, size_t(partsNum) * 20);
+    const std::uint64_t maxVWeight = std::max<std::uint64_t>(1, 3 * n / (2 * coarsenTo));
+    std::vector<LevelGraph> levels;
+    std::vector<std::vector<std::uint32_t>> cmaps;
+    levels.push_back(makeLevelGraph(g));
+    while(levels.back().getVerticesNum() > coarsenTo)
+    {
+        std::uint32_t coarseNum;
+        std::vector<std::uint32_t> cmap = matchHeavyEdges(levels.back(), maxVWeight, rnd,
+                                                          coarseNum);
+        if(coarseNum > levels.back().getVerticesNum() * 95 / 100)
+            break;
+
+        LevelGraph cg = contract(levels.back(), cmap, coarseNum);
+        levels.push_back(std::move(cg));
+        cmaps.push_back(std::move(cmap));
+    }
+
+    // slack for the heaviest vertex of a coarse level
+    auto getLimit = [&](const LevelGraph& lg)
+    {
+        return &lg == &levels.front() ? maxW
+                : maxW + *std::max_element(lg.vweights.begin(), lg.vweights.end());
+    };
+
+    // initial partition
+    const LevelGraph& top = levels.back();
+    std::vector<std::uint32_t> parts;
+    std::uint64_t bestCut = 0;
+    for(int i = 0; i < 4; ++i)
+    {
+        std::vector<std::uint32_t> tryParts = growParts(top, partsNum, rnd);
+        Refiner r(top, partsNum, getLimit(top), tryParts);
+        r.rebalance();
+        r.refine();
+        std::uint64_t cut = getCutWeight(top, tryParts);
+        if(parts.empty() || cut < bestCut)
+        {
+            parts.swap(tryParts);
+            bestCut = cut;
+        }
+    }
+
+    // uncoarsening
+    for(size_t l = cmaps.size(); l-- > 0; )
+    {
+        std::vector<std::uint32_t> fine(levels[l].getVerticesNum());
+        for(size_t v = 0; v < fine.size(); ++v)
+            fine[v] = parts[cmaps[l][v]];
+        parts.swap(fine);
+
+        Refiner r(levels[l], partsNum, getLimit(levels[l]), parts);
+        if(l == 0)
+            r.rebalance();
+        r.refine();
+    }
+
+    return makePartition(g, std::move(parts), partsNum);
+}
+
+
+/// Objective of a streaming partitioner.
+enum class StreamingObjective {
+    LDG,        ///< Linear deterministic greedy (Stanton and Kliot).
+    FENNEL      ///< Fennel (Tsourakakis et al.).
+};
+
+/*! ****************************************************************************
+ *  \brief The StreamingPartitioner class assigns vertices to parts in one
+ *  pass as they arrive, e.g. while a graph is being loaded.
+ *
+ *  A vertex goes to the part with the best score among those with room,
+ *  given the neighbours assigned so far; ties go to the smaller part. With
+ *  N(v) the assigned neighbours, P the part and C the part capacity:
+ *  - LDG scores |N(v) ∩ P|·(1 − |P|/C);
+ *  - Fennel scores |N(v) ∩ P| − α·γ·|P|^(γ−1) with γ = 1.5 and
+ *    α = √k·m/n^1.5, which approximates the cut plus a penalty for the part
+ *    sizes.
+ *
+ *  Each vertex costs O(deg + k). The cut is typically a few times that of
+ *  the multilevel partitioner, which needs the whole graph in memory.
+ ******************************************************************************/
+class StreamingPartitioner {
+public:
+    /// \brief Prepares to partition a graph of \a verticesNum vertices (dense
+    /// ids below it) and about \a edgesNum edges into \a partsNum parts of at
+    /// most (1 + \a imbalance)·n/k vertices each.
+    StreamingPartitioner(std::uint32_t partsNum, size_t verticesNum, size_t edgesNum,
+                         StreamingObjective objective = StreamingObjective::FENNEL,
+                         double imbalance = 0.05)
+        : _objective(objective), _partIds(verticesNum, partition_details::NONE),
+          _partSizes(partsNum, 0), _scores(partsNum, 0), _cutEdges(0)
+    {
+        if(partsNum == 0)
+            throw std::invalid_argument("The number of parts must be positive");
+        if(imbalance < 0)
+            throw std::invalid_argument("The imbalance must be nonnegative");
+
+        double n = static_cast<double>(std::max<size_t>(verticesNum, 1));
+        _capacity = std::max<size_t>(1, static_cast<size_t>(
+                std::ceil((1 + imbalance) * n / partsNum)));
+        _alpha = std::sqrt(static_cast<double>(partsNum)) * static_cast<double>(edgesNum)
+                 / std::pow(n, 1.5);
+    }
+
+public:
+    /// \brief Assigns the vertex \a v with the neighbours [\a begin, \a end)
+    /// to a part, which is returned.
+    ///
+    /// Neighbours not yet assigned are skipped; an edge counts in the cut once
+    /// its both ends are assigned.
+    template <typename AdjIter>
+    std::uint32_t addVertex(std::uint32_t v, AdjIter begin, AdjIter end)
+    {
+        if(v >= _partIds.size())
+            throw std::invalid_argument("The vertex id is out of range");
+        if(_partIds[v] != partition_details::NONE)
+            throw std::invalid_argument("The vertex is already assigned");
+
+        for(AdjIter it = begin; it != end; ++it)
+        {
+            std::uint32_t u = *it;
+            if(u == v || u >= _partIds.size() || _partIds[u] == partition_details::NONE)
+                continue;
+            if(_scores[_partIds[u]] == 0)
+                _touched.push_back(_partIds[u]);
+            _scores[_partIds[u]] += 1;
+        }
+
+        std::uint32_t best = partition_details::NONE;
+        double bestScore = 0;
+        for(std::uint32_t p = 0; p < _partSizes.size(); ++p)
+        {
+            if(_partSizes[p] >= _capacity)
+                continue;
+
+            double size = static_cast<double>(_partSizes[p]);
+            double score = _objective == StreamingObjective::LDG
+                    ? _scores[p] * (1 - size / static_cast<double>(_capacity))
+                    : _scores[p] - _alpha * 1.5 * std::sqrt(size);
+            if(best == partition_details::NONE || score > bestScore
+                || (score == bestScore && _partSizes[p] < _partSizes[best]))
+            {
+                best = p;
+                bestScore = score;
+            }
+        }
+        if(best == partition_details::NONE)        // all full: more vertices than told
+            best = static_cast<std::uint32_t>(
+                    std::min_element(_partSizes.begin(), _partSizes.end()) - _partSizes.begin());
+
+        for(std::uint32_t p : _touched)
+        {
+            if(p != best)
+                _cutEdges += static_cast<size_t>(_scores[p]);
+            _scores[p] = 0;
+        }
+        _touched.clear();
+
+        _partIds[v] = best;
+        ++_partSizes[best];
+
+        return best;
+    }
+
+    /// Returns the part of \a v, or -1 if it is not assigned.
+    std::uint32_t getPart(std::uint32_t v) const { return _partIds[v]; }
+
+    /// \brief Returns the partition of the vertices assigned so far; the cut
+    /// counts the edges given with their second end.
+    GraphPartition getPartition() const
+    {
+        return {_partIds, static_cast<std::uint32_t>(_partSizes.size()), _partSizes,
+                _cutEdges};
+    }
+
+protected:
+    StreamingObjective _objective;
+    size_t _capacity;
+    double _alpha;                          ///< Fennel's size penalty factor.
+    std::vector<std::uint32_t> _partIds;
+    std::vector<size_t> _partSizes;
+    std::vector<double> _scores;            ///< Assigned neighbours by parts.
+    std::vector<std::uint32_t> _touched;    ///< Parts with nonzero _scores.
+    size_t _cutEdges;
+}; // class StreamingPartitioner
+
+/// \brief Partitions \a g by a StreamingPartitioner streaming its vertices
+/// in the order of dense ids.
+///
+/// \tparam TGraph is a graph type with dense ids, such as CsrEdgeLblUGraph.
+template <typename TGraph>
+GraphPartition partitionGraphStreaming(const TGraph& g, std::uint32_t partsNum,
+                                       StreamingObjective objective = StreamingObjective::FENNEL,
+                                       double imbalance = 0.05)
+{
+    typedef typename TGraph::VId VId;
+
+    StreamingPartitioner sp(partsNum, g.getVerticesNum(), g.getEdgesNum(), objective,
+                            imbalance);
+    for(VId v = 0; v < g.getVerticesNum(); ++v)
+        sp.addVertex(v, g.getAdjVertices(v).first, g.getAdjVertices(v).second);
+
+    return sp.getPartition();
+}
+
+
+namespace partition_details {
+
+/// \brief Local structure of a part: its own vertices by increasing dense
+/// ids of the whole graph, then the ghosts the same way.
+struct PartLayout {
+    std::vector<std::uint32_t> globalIds;   ///< Dense ids in the whole graph.
+    size_t ownedNum;
+    std::vector<std::uint32_t> owners;      ///< Parts of the ghosts.
+    std::vector<size_t> offsets;
+    std::vector<std::uint32_t> adj;
+    std::vector<size_t> srcPos;             ///< Positions of adj in the whole graph.
+    size_t edgesNum;                        ///< Edges with an own end.
+};
+
+template <typename TGraph>
+PartLayout makePartLayout(const TGraph& g, const std::vector<std::uint32_t>& partIds,
+                          std::uint32_t part)
+{
+    typedef typename TGraph::VId VId;
+
+    if(partIds.size() != g.getVerticesNum())
+        throw std::invalid_argument("The partition does not match the graph");
+
+    PartLayout pl;
+    for(VId v = 0; v < g.getVerticesNum(); ++v)
+        if(partIds[v] == part)
+            pl.globalIds.push_back(v);
+    pl.ownedNum = pl.globalIds.size();
+
+    std::vector<std::uint32_t> ghosts;
+    for(size_t i = 0; i < pl.ownedNum; ++i)
+    {
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(pl.globalIds[i]);
+        for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+            if(partIds[*it] != part)
+                ghosts.push_back(*it);
+    }
+    std::sort(ghosts.begin(), ghosts.end());
+    ghosts.erase(std::unique(ghosts.begin(), ghosts.end()), ghosts.end());
+    for(std::uint32_t u : ghosts)
+        pl.owners.push_back(partIds[u]);
+    pl.globalIds.insert(pl.globalIds.end(), ghosts.begin(), ghosts.end());
+
+    const std::vector<std::uint32_t>::const_iterator ownedEnd =
+            pl.globalIds.begin() + pl.ownedNum;
+    auto getLocal = [&](std::uint32_t u)
+    {
+        return static_cast<std::uint32_t>(partIds[u] == part
+                ? std::lower_bound(pl.globalIds.cbegin(), ownedEnd, u) - pl.globalIds.cbegin()
+                : pl.ownedNum + (std::lower_bound(ghosts.cbegin(), ghosts.cend(), u)
+                                 - ghosts.cbegin()));
+    };
+
+    // the ghosts come after the own vertices, so the lists are sorted anew
+    std::vector<std::pair<std::uint32_t, size_t>> list;
+    pl.offsets.reserve(pl.globalIds.size() + 1);
+    pl.offsets.push_back(0);
+    size_t loops = 0, cut = 0;
+    for(size_t i = 0; i < pl.ownedNum; ++i)
+    {
+        VId v = pl.globalIds[i];
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+        size_t pos = g.getAdjOffset(v);
+        list.clear();
+        for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it, ++pos)
+        {
+            list.push_back({getLocal(*it), pos});
+            if(*it == v)
+                ++loops;
+            else if(partIds[*it] != part)
+                ++cut;
+        }
+        std::sort(list.begin(), list.end());
+        for(const std::pair<std::uint32_t, size_t>& e : list)
+        {
+            pl.adj.push_back(e.first);
+            pl.srcPos.push_back(e.second);
+        }
+        pl.offsets.push_back(pl.adj.size());
+    }
+    pl.offsets.resize(pl.globalIds.size() + 1, pl.adj.size());
+    pl.edgesNum = (pl.adj.size() - loops - cut) / 2 + loops + cut;
+
+    return pl;
+}
+
+} // namespace partition_details
+
+
+/// \brief The ghost table of a part subgraph: which local vertices are
+/// owned by other parts, and how they map to the whole graph.
+class PartGhostTable {
+public:
+    /// Returns the part of the subgraph.
+    std::uint32_t getPart() const { return _part; }
+
+    /// Returns the number of own vertices, which have local ids below it.
+    size_t getOwnedNum() const { return _ownedNum; }
+
+    size_t getGhostsNum() const { return _owners.size(); }
+
+    /// Returns true if the local vertex \a v is a ghost.
+    bool isGhost(std::uint32_t v) const { return v >= _ownedNum; }
+
+    /// Returns the dense id in the whole graph of the local vertex \a v.
+    std::uint32_t getGlobalId(std::uint32_t v) const { return _globalIds[v]; }
+
+    /// Returns the part owning the local vertex \a v.
+    std::uint32_t getOwner(std::uint32_t v) const
+    {
+        return isGhost(v) ? _owners[v - _ownedNum] : _part;
+    }
+
+protected:
+    void setLayout(std::uint32_t part, partition_details::PartLayout& pl)
+    {
+        _part = part;
+        _ownedNum = pl.ownedNum;
+        _globalIds.swap(pl.globalIds);
+        _owners.swap(pl.owners);
+    }
+
+protected:
+    std::uint32_t _part = 0;
+    size_t _ownedNum = 0;
+    std::vector<std::uint32_t> _globalIds;  ///< By local ids.
+    std::vector<std::uint32_t> _owners;     ///< By local ids of the ghosts.
+}; // class PartGhostTable
+
+
+/*! ****************************************************************************
+ *  \brief The CsrUGraphPart class represents the subgraph of a part of a
+ *  partitioned CsrUGraph.
+ *
+ *  Local dense ids 0..getOwnedNum()-1 are the vertices of the part, followed
+ *  by the ghosts, their neighbours in other parts. An own vertex has all its
+ *  edges, so a worker sees its whole neighbourhood; a ghost has none, only
+ *  standing for a remote vertex whose state comes from its owner. The
+ *  subgraph counts the edges with an own end; getVertex() and getVId() use
+ *  the original vertices.
+ *
+ *  \tparam Vertex represents a type for vertices. See requirements for UGraph.
+ ******************************************************************************/
+template <typename Vertex>
+class CsrUGraphPart
+        : public CsrUGraph<Vertex>, public PartGhostTable
+{
+public:
+    typedef CsrUGraph<Vertex> Base;
+
+public:
+    /// Creates an empty subgraph.
+    CsrUGraphPart()
+    {
+    }
+
+    /// Makes the subgraph of the part \a part of \a g partitioned by \a p.
+    CsrUGraphPart(const CsrUGraph<Vertex>& g, const GraphPartition& p, std::uint32_t part)
+    {
+        partition_details::PartLayout pl = partition_details::makePartLayout(g, p.partIds, part);
+
+        std::vector<Vertex> vertices;
+        vertices.reserve(pl.globalIds.size());
+        for(std::uint32_t v : pl.globalIds)
+            vertices.push_back(g.getVertex(v));
+        Base::assign(std::move(vertices), std::move(pl.offsets), std::move(pl.adj),
+                     pl.edgesNum);
+        setLayout(part, pl);
+    }
+}; // class CsrUGraphPart
+
+
+/// \brief The CsrEdgeLblUGraphPart class represents the subgraph of a part of
+/// a partitioned CsrEdgeLblUGraph, with the edge labels; see CsrUGraphPart.
+template <typename Vertex, typename EdgeLbl>
+class CsrEdgeLblUGraphPart
+        : public CsrEdgeLblUGraph<Vertex, EdgeLbl>, public PartGhostTable
+{
+public:
+    typedef CsrEdgeLblUGraph<Vertex, EdgeLbl> Base;
+
+public:
+    /// Creates an empty subgraph.
+    CsrEdgeLblUGraphPart()
+    {
+    }
+
+    /// Makes the subgraph of the part \a part of \a g partitioned by \a p.
+    CsrEdgeLblUGraphPart(const CsrEdgeLblUGraph<Vertex, EdgeLbl>& g, const GraphPartition& p,
+                         std::uint32_t part)
+    {
+        partition_details::PartLayout pl = partition_details::makePartLayout(g, p.partIds, part);
+
+        Base::_labels.reserve(pl.srcPos.size());
+        const EdgeLbl* lbls = g.getAdjLabels(0);
+        for(size_t pos : pl.srcPos)
+            Base::_labels.push_back(lbls[pos]);
+
+        std::vector<Vertex> vertices;
+        vertices.reserve(pl.globalIds.size());
+        for(std::uint32_t v : pl.globalIds)
+            vertices.push_back(g.getVertex(v));
+        Base::assign(std::move(vertices), std::move(pl.offsets), std::move(pl.adj),
+                     pl.edgesNum);
+        setLayout(part, pl);
+    }
+}; // class CsrEdgeLblUGraphPart
+
+
+/// \brief Makes the subgraphs of all the parts of \a g partitioned by \a p
+/// on \a threadsNum threads (all the hardware ones if 0).
+///
+/// Each part takes a scan of the partition, so this suits numbers of parts
+/// up to the numbers of cores or processes.
+template <typename Vertex>
+std::vector<CsrUGraphPart<Vertex>> makeGraphParts(const CsrUGraph<Vertex>& g,
+                                                  const GraphPartition& p,
+                                                  unsigned threadsNum = 0)
+{
+    std::vector<CsrUGraphPart<Vertex>> parts(p.partsNum);
+    par::parallelFor(p.partsNum, threadsNum, [&](size_t i, unsigned)
+    {
+        parts[i] = CsrUGraphPart<Vertex>(g, p, static_cast<std::uint32_t>(i));
+    }, 1);
+
+    return parts;
+}
+
+/// The same for a graph with edge labels, which the subgraphs keep.
+template <typename Vertex, typename EdgeLbl>
+std::vector<CsrEdgeLblUGraphPart<Vertex, EdgeLbl>>
+makeGraphParts(const CsrEdgeLblUGraph<Vertex, EdgeLbl>& g, const GraphPartition& p,
+               unsigned threadsNum = 0)
+{
+    std::vector<CsrEdgeLblUGraphPart<Vertex, EdgeLbl>> parts(p.partsNum);
+    par::parallelFor(p.partsNum, threadsNum, [&](size_t i, unsigned)
+    {
+        parts[i] = CsrEdgeLblUGraphPart<Vertex, EdgeLbl>(g, p, static_cast<std::uint32_t>(i));
+    }, 1);
+
+    return parts;
+}
+
+
+#endif // UGRAPH_PARTITION_HPP
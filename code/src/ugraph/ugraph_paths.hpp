@@ -0,0 +1,336 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains implementations of single-source shortest paths
+///             algorithms for labeled undirected graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UGRAPH_PATHS_HPP
+#define UGRAPH_PATHS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "bit_utils.hpp"
+#include "csr_lbl_ugraph.hpp"
+#include "par_utils.hpp"
+
+
+/*! ****************************************************************************
+ *  \brief Monotone radix heap with unsigned integer keys.
+ *
+ *  A key being pushed must not be less than the key popped last, which always
+ *  holds for Dijkstra's algorithm with non-negative edge lengths. Every
+ *  element moves through at most 65 buckets, so both operations are
+ *  amortized O(log C) where C is the maximum key.
+ *
+ *  \tparam Value represents a type for values stored along with the keys.
+ ******************************************************************************/
+template <typename Value>
+class RadixHeap {
+public:
+    typedef std::uint64_t Key;
+    typedef std::pair<Key, Value> Entry;
+
+public:
+    RadixHeap()
+        : _last(0), _size(0)
+    {
+    }
+
+    bool empty() const { return _size == 0; }
+    size_t size() const { return _size; }
+
+    /// Adds a new element; \a k must not be less than the last popped key.
+    void push(Key k, const Value& v)
+    {
+        _buckets[getBucket(k)].push_back({k, v});
+        ++_size;
+    }
+
+    /// Extracts an element with the minimum key.
+    Entry pop()
+    {
+        if(_buckets[0].empty())
+        {
+            // redistributes the first non-empty bucket around its minimum
+            size_t i = 1;
+            while(_buckets[i].empty())
+                ++i;
+
+            Key minKey = _buckets[i][0].first;
+            for(const Entry& e : _buckets[i])
+                if(e.first < minKey)
+                    minKey = e.first;
+
+            _last = minKey;
+            for(const Entry& e : _buckets[i])
+                _buckets[getBucket(e.first)].push_back(e);
+            _buckets[i].clear();
+        }
+
+        Entry e = _buckets[0].back();
+        _buckets[0].pop_back();
+        --_size;
+
+        return e;
+    }
+
+protected:
+    /// Bucket 0 keeps keys equal to the last popped one, bucket i keeps keys
+    /// whose highest bit that differs from it is bit (i - 1).
+    size_t getBucket(Key k) const
+    {
+        return bits::getBitWidth(k ^ _last);
+    }
+
+protected:
+    std::vector<Entry> _buckets[65];
+    Key _last;                      ///< The last popped key.
+    size_t _size;
+}; // class RadixHeap
+
+
+/// Result of a single-source shortest paths search.
+template <typename VId, typename Dist>
+struct ShortestPaths {
+    /// Distances from the source; infinity() for unreachable vertices.
+    std::vector<Dist> dists;
+
+    /// Predecessors in the shortest paths tree; noPred() for the source and
+    /// unreachable vertices.
+    std::vector<VId> preds;
+
+    static Dist infinity() { return std::numeric_limits<Dist>::max(); }
+    static VId noPred() { return std::numeric_limits<VId>::max(); }
+};
+
+
+namespace paths_details {
+
+/// Throws if the edge length \a w is negative.
+template <typename Dist>
+inline void checkLength(Dist w)
+{
+    if(w < Dist())
+        throw std::invalid_argument("Negative edge label for shortest paths");
+}
+
+/// Dijkstra's algorithm with a radix heap, for integral labels.
+template <typename TGraph>
+void runDijkstra(const TGraph& g,
+                 ShortestPaths<typename TGraph::VId, typename TGraph::Label>& sp,
+                 typename TGraph::VId src, std::true_type)
+{
+    typedef typename TGraph::VId VId;
+    typedef typename TGraph::Label Dist;
+
+    RadixHeap<VId> heap;
+    heap.push(0, src);
+    while(!heap.empty())
+    {
+        typename RadixHeap<VId>::Entry top = heap.pop();
+        VId v = top.second;
+        Dist d = static_cast<Dist>(top.first);
+        if(d != sp.dists[v])
+            continue;                           // outdated entry
+
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+        typename TGraph::AdjLblIter lbl = g.getAdjLabels(v);
+        for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it, ++lbl)
+        {
+            checkLength(*lbl);
+            Dist nd = d + *lbl;
+            if(nd < sp.dists[*it])
+            {
+                sp.dists[*it] = nd;
+                sp.preds[*it] = v;
+                heap.push(static_cast<typename RadixHeap<VId>::Key>(nd), *it);
+            }
+        }
+    }
+}
+
+/// Dijkstra's algorithm with a binary heap, for arbitrary labels.
+template <typename TGraph>
+void runDijkstra(const TGraph& g,
+                 ShortestPaths<typename TGraph::VId, typename TGraph::Label>& sp,
+                 typename TGraph::VId src, std::false_type)
+{
+    typedef typename TGraph::VId VId;
+    typedef typename TGraph::Label Dist;
+    typedef std::pair<Dist, VId> Entry;
+
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+    heap.push({Dist(), src});
+    while(!heap.empty())
+    {
+        Entry top = heap.top();
+        heap.pop();
+        VId v = top.second;
+        Dist d = top.first;
+        if(sp.dists[v] < d)
+            continue;                           // outdated entry
+
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+        typename TGraph::AdjLblIter lbl = g.getAdjLabels(v);
+        for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it, ++lbl)
+        {
+            checkLength(*lbl);
+            Dist nd = d + *lbl;
+            if(nd < sp.dists[*it])
+            {
+                sp.dists[*it] = nd;
+                sp.preds[*it] = v;
+                heap.push({nd, *it});
+            }
+        }
+    }
+}
+
+} // namespace paths_details
+
+
+/// \brief Finds shortest paths from the vertex \a src to all other vertices
+/// of the graph \a g using Dijkstra's algorithm.
+///
+/// Edge labels are treated as edge lengths and must be non-negative. Uses a
+/// radix heap for integral labels and a binary heap for other ones.
+///
+/// \tparam TGraph is a labeled graph type with dense ids, such as
+/// CsrEdgeLblUGraph.
+template <typename TGraph>
+ShortestPaths<typename TGraph::VId, typename TGraph::Label>
+    findShortestPathsDijkstra(const TGraph& g, typename TGraph::VId src)
+{
+    typedef ShortestPaths<typename TGraph::VId, typename TGraph::Label> Result;
+
+    if(src >= g.getVerticesNum())
+        throw std::invalid_argument("Source vertex does not exist");
+
+    Result sp;
+    sp.dists.assign(g.getVerticesNum(), Result::infinity());
+    sp.preds.assign(g.getVerticesNum(), Result::noPred());
+    sp.dists[src] = typename TGraph::Label();
+
+    paths_details::runDijkstra(g, sp, src,
+                std::is_integral<typename TGraph::Label>());
+
+    return sp;
+}
+
+
+/// \brief Finds distances from the vertex \a src to all other vertices of the
+/// graph \a g using parallel delta-stepping on \a threadsNum threads.
+///
+/// Vertices are processed in buckets of width \a delta: the smaller it is, the
+/// closer the algorithm to Dijkstra's one; the larger, the more parallelism
+/// and redundant relaxations. A good start is an average edge length. Note
+/// that the number of buckets is (max distance / delta).
+///
+/// \return distances from \a src, infinity for unreachable vertices.
+template <typename TGraph>
+std::vector<typename TGraph::Label>
+    findDistancesDeltaStepping(const TGraph& g, typename TGraph::VId src,
+                               typename TGraph::Label delta,
+                               unsigned threadsNum = 0)
+{
+    typedef typename TGraph::VId VId;
+    typedef typename TGraph::Label Dist;
+    typedef std::vector<std::vector<VId>> Bins;
+
+    const size_t n = g.getVerticesNum();
+    if(src >= n)
+        throw std::invalid_argument("Source vertex does not exist");
+    if(!(Dist() < delta))
+        throw std::invalid_argument("Bucket width must be positive");
+
+    const Dist inf = std::numeric_limits<Dist>::max();
+    std::vector<std::atomic<Dist>> dists(n);
+    par::parallelFor(n, threadsNum, [&](size_t i, unsigned)
+    {
+        dists[i].store(inf, std::memory_order_relaxed);
+    }, 1 << 14);
+    dists[src].store(Dist(), std::memory_order_relaxed);
+
+    threadsNum = par::getThreadsNum(threadsNum);
+    std::vector<Bins> localBins(threadsNum);
+    std::vector<VId> frontier(1, src);
+    size_t curBin = 0;
+
+    while(!frontier.empty())
+    {
+        par::parallelFor(frontier.size(), threadsNum, [&](size_t i, unsigned tid)
+        {
+            VId v = frontier[i];
+            Dist d = dists[v].load(std::memory_order_relaxed);
+
+            // the vertex has been improved and settled in an earlier bucket
+            if(d < delta * static_cast<Dist>(curBin))
+                return;
+
+            Bins& bins = localBins[tid];
+            typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+            typename TGraph::AdjLblIter lbl = g.getAdjLabels(v);
+            for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it, ++lbl)
+            {
+                paths_details::checkLength(*lbl);
+                Dist nd = d + *lbl;
+                if(par::atomicMin(dists[*it], nd))
+                {
+                    size_t b = static_cast<size_t>(nd / delta);
+                    if(b >= bins.size())
+                        bins.resize(b + 1);
+                    bins[b].push_back(*it);
+                }
+            }
+        }, 64);
+
+        // the next bucket is the lowest non-empty one among all threads
+        size_t nextBin = std::numeric_limits<size_t>::max();
+        for(const Bins& bins : localBins)
+            for(size_t b = curBin; b < bins.size() && b < nextBin; ++b)
+                if(!bins[b].empty())
+                {
+                    nextBin = b;
+                    break;
+                }
+
+        frontier.clear();
+        if(nextBin == std::numeric_limits<size_t>::max())
+            break;
+
+        for(Bins& bins : localBins)
+            if(nextBin < bins.size())
+            {
+                frontier.insert(frontier.end(), bins[nextBin].begin(),
+                                bins[nextBin].end());
+                bins[nextBin].clear();
+            }
+        curBin = nextBin;
+    }
+
+    std::vector<Dist> res(n);
+    for(size_t i = 0; i < n; ++i)
+        res[i] = dists[i].load(std::memory_order_relaxed);
+
+    return res;
+}
+
+
+#endif // UGRAPH_PATHS_HPP
@@ -0,0 +1,349 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains vertex orderings improving the memory locality of
+///             graph algorithms.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+/// Every function returns a permutation of dense ids, newIds[v] being the new
+/// id of the vertex v, to be applied by the permuting constructors of
+/// CsrUGraph and CsrEdgeLblUGraph:
+///
+///     CsrUGraph<int> csr(g);
+///     CsrUGraph<int> local(csr, findRcmOrder(csr));
+///
+/// The reordered graph maps dense ids to the original vertices as before.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UGRAPH_REORDER_HPP
+#define UGRAPH_REORDER_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "csr_ugraph.hpp"
+
+
+namespace reorder_details {
+
+/// Turns the list of vertices in their new order into new ids by vertices.
+template <typename VId>
+std::vector<VId> makeNewIds(const std::vector<VId>& order)
+{
+    std::vector<VId> newIds(order.size());
+    for(size_t i = 0; i < order.size(); ++i)
+        newIds[order[i]] = static_cast<VId>(i);
+
+    return newIds;
+}
+
+/// \brief Runs BFS from \a s over its component; returns the number of
+/// levels and the vertices of the last level in \a last.
+///
+/// \a dist must be all none; the reached entries are reset on return.
+template <typename TGraph>
+size_t findLastLevel(const TGraph& g, typename TGraph::VId s,
+                     std::vector<typename TGraph::VId>& dist,
+                     std::vector<typename TGraph::VId>& last)
+{
+    typedef typename TGraph::VId VId;
+    const VId none = static_cast<VId>(-1);
+
+    std::vector<VId> reached(1, s);
+    dist[s] = 0;
+    size_t levelBeg = 0;
+    for(size_t i = 0; i < reached.size(); ++i)
+    {
+        VId v = reached[i];
+        if(dist[v] != dist[reached[levelBeg]])
+            levelBeg = i;
+
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+        for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+            if(dist[*it] == none)
+            {
+                dist[*it] = dist[v] + 1;
+                reached.push_back(*it);
+            }
+    }
+
+    size_t levels = dist[reached.back()] + 1;
+    last.assign(reached.begin() + levelBeg, reached.end());
+    for(VId v : reached)
+        dist[v] = none;
+
+    return levels;
+}
+
+/// \brief Finds a pseudo-peripheral vertex of the component of \a s (George
+/// and Liu): a vertex of the last BFS level is taken while the number of
+/// levels grows.
+template <typename TGraph>
+typename TGraph::VId findPeripheral(const TGraph& g, typename TGraph::VId s,
+                                    std::vector<typename TGraph::VId>& dist)
+{
+    typedef typename TGraph::VId VId;
+
+    std::vector<VId> last;
+    size_t levels = findLastLevel(g, s, dist, last);
+    while(true)
+    {
+        VId u = *std::min_element(last.begin(), last.end(), [&g](VId a, VId b)
+        {
+            return g.getDegree(a) < g.getDegree(b);
+        });
+        std::vector<VId> uLast;
+        size_t uLevels = findLastLevel(g, u, dist, uLast);
+        if(uLevels <= levels)
+            return s;
+
+        s = u;
+        levels = uLevels;
+        last.swap(uLast);
+    }
+}
+
+/// \brief Max-priority queue of vertices with keys changed by ±1, as in
+/// Gorder: a bucket (doubly linked list) per key, so that an update and
+/// taking the top cost O(1) amortized.
+template <typename VId>
+class UnitHeap {
+public:
+    explicit UnitHeap(size_t n)
+        : _keys(n, 0), _prev(n), _next(n), _heads(1, NONE), _top(0), _removed(n, false)
+    {
+        for(size_t i = n; i-- > 0; )            // vertex 0 on the head
+            link(static_cast<VId>(i));
+    }
+
+    /// Adds \a delta to the key of \a v, unless it is removed.
+    void update(VId v, int delta)
+    {
+        if(_removed[v])
+            return;
+
+        unlink(v);
+        _keys[v] = static_cast<size_t>(static_cast<long long>(_keys[v]) + delta);
+        link(v);
+    }
+
+    void remove(VId v)
+    {
+        unlink(v);
+        _removed[v] = true;
+    }
+
+    /// Removes and returns a vertex of the largest key; there must be one.
+    VId popTop()
+    {
+        while(_heads[_top] == NONE)
+            --_top;
+
+        VId v = _heads[_top];
+        remove(v);
+        return v;
+    }
+
+protected:
+    void link(VId v)
+    {
+        size_t k = _keys[v];
+        if(k >= _heads.size())
+            _heads.resize(k + 1, NONE);
+        _prev[v] = NONE;
+        _next[v] = _heads[k];
+        if(_heads[k] != NONE)
+            _prev[_heads[k]] = v;
+        _heads[k] = v;
+        _top = std::max(_top, k);
+    }
+
+    void unlink(VId v)
+    {
+        if(_prev[v] != NONE)
+            _next[_prev[v]] = _next[v];
+        else
+            _heads[_keys[v]] = _next[v];
+        if(_next[v] != NONE)
+            _prev[_next[v]] = _prev[v];
+    }
+
+protected:
+    static constexpr VId NONE = static_cast<VId>(-1);
+
+    std::vector<size_t> _keys;
+    std::vector<VId> _prev;
+    std::vector<VId> _next;
+    std::vector<VId> _heads;        ///< First vertices of the buckets by keys.
+    size_t _top;                    ///< No larger keys are used.
+    std::vector<bool> _removed;
+}; // class UnitHeap
+
+template <typename VId>
+constexpr VId UnitHeap<VId>::NONE;
+
+} // namespace reorder_details
+
+
+/// \brief Orders vertices by decreasing degrees, ties by dense ids.
+///
+/// The cheapest ordering: hubs, which most edges lead to, get packed
+/// together at the beginning of per-vertex arrays.
+///
+/// \tparam TGraph is a graph type with dense ids, such as CsrUGraph.
+/// \return new dense ids by the old ones.
+template <typename TGraph>
+std::vector<typename TGraph::VId> findDegreeOrder(const TGraph& g)
+{
+    typedef typename TGraph::VId VId;
+
+    std::vector<VId> order(g.getVerticesNum());
+    for(size_t v = 0; v < order.size(); ++v)
+        order[v] = static_cast<VId>(v);
+    std::stable_sort(order.begin(), order.end(), [&g](VId a, VId b)
+    {
+        return g.getDegree(a) > g.getDegree(b);
+    });
+
+    return reorder_details::makeNewIds(order);
+}
+
+/// \brief Orders vertices by the reverse Cuthill-McKee algorithm.
+///
+/// Each connected component is traversed by BFS from a pseudo-peripheral
+/// vertex, visiting the neighbours of a vertex by increasing degrees, and
+/// the whole order is reversed. Neighbours get close ids (a small bandwidth
+/// of the adjacency matrix), which suits meshes and road networks best.
+///
+/// \tparam TGraph is a graph type with dense ids, such as CsrUGraph.
+/// \return new dense ids by the old ones.
+template <typename TGraph>
+std::vector<typename TGraph::VId> findRcmOrder(const TGraph& g)
+{
+    typedef typename TGraph::VId VId;
+    const VId none = static_cast<VId>(-1);
+    const size_t n = g.getVerticesNum();
+
+    // components start from vertices of the smallest degrees
+    std::vector<VId> starts(n);
+    for(size_t v = 0; v < n; ++v)
+        starts[v] = static_cast<VId>(v);
+    std::stable_sort(starts.begin(), starts.end(), [&g](VId a, VId b)
+    {
+        return g.getDegree(a) < g.getDegree(b);
+    });
+
+    std::vector<VId> order, dist(n, none), adj;
+    std::vector<bool> visited(n, false);
+    order.reserve(n);
+    for(VId s : starts)
+    {
+        if(visited[s])
+            continue;
+
+        s = reorder_details::findPeripheral(g, s, dist);
+        visited[s] = true;
+        order.push_back(s);
+        for(size_t i = order.size() - 1; i < order.size(); ++i)
+        {
+            adj.clear();
+            typename TGraph::AdjIterPair vs = g.getAdjVertices(order[i]);
+            for(typename TGraph::AdjIter it = vs.first; it != vs.second; ++it)
+                if(!visited[*it])
+                {
+                    visited[*it] = true;
+                    adj.push_back(*it);
+                }
+
+            std::stable_sort(adj.begin(), adj.end(), [&g](VId a, VId b)
+            {
+                return g.getDegree(a) < g.getDegree(b);
+            });
+            order.insert(order.end(), adj.begin(), adj.end());
+        }
+    }
+    std::reverse(order.begin(), order.end());
+
+    return reorder_details::makeNewIds(order);
+}
+
+/*! ****************************************************************************
+ *  \brief Orders vertices greedily by Gorder (Wei et al.): each next vertex
+ *  is the one sharing most with the last \a window placed vertices.
+ *
+ *  The score of a vertex is the number of its edges to the window plus the
+ *  number of its common neighbours with the window vertices, so vertices
+ *  accessed together in traversals land in the same cache lines. The
+ *  scores are kept in a UnitHeap updated as vertices enter and leave the
+ *  window. Common neighbours via hubs (degree above √n) are not counted,
+ *  which bounds the time by O(Σ deg² of the rest) with little loss.
+ *
+ *  Slower to compute than the other orderings, but gives the best locality
+ *  for social and web graphs.
+ *
+ *  \tparam TGraph is a graph type with dense ids, such as CsrUGraph.
+ *  \return new dense ids by the old ones.
+ ******************************************************************************/
+template <typename TGraph>
+std::vector<typename TGraph::VId> findGorderOrder(const TGraph& g, unsigned window = 5)
+{
+    typedef typename TGraph::VId VId;
+    const size_t n = g.getVerticesNum();
+    if(n == 0)
+        return {};
+
+    const size_t hubDegree = static_cast<size_t>(std::sqrt(static_cast<double>(n)));
+    reorder_details::UnitHeap<VId> heap(n);
+
+    // the vertex v enters (delta = 1) or leaves (-1) the window
+    auto update = [&](VId v, int delta)
+    {
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(v);
+        for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+        {
+            VId u = *it;
+            heap.update(u, delta);
+            if(g.getDegree(u) > hubDegree)
+                continue;
+
+            typename TGraph::AdjIterPair sibs = g.getAdjVertices(u);
+            for(typename TGraph::AdjIter jt = sibs.first; jt != sibs.second; ++jt)
+                if(*jt != v)
+                    heap.update(*jt, delta);
+        }
+    };
+
+    VId first = 0;
+    for(size_t v = 1; v < n; ++v)
+        if(g.getDegree(static_cast<VId>(v)) > g.getDegree(first))
+            first = static_cast<VId>(v);
+
+    std::vector<VId> order;
+    order.reserve(n);
+    heap.remove(first);
+    order.push_back(first);
+    update(first, 1);
+    while(order.size() < n)
+    {
+        VId v = heap.popTop();
+        order.push_back(v);
+        update(v, 1);
+        if(order.size() > window)
+            update(order[order.size() - 1 - window], -1);
+    }
+
+    return reorder_details::makeNewIds(order);
+}
+
+
+#endif // UGRAPH_REORDER_HPP
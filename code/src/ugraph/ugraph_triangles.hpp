@@ -0,0 +1,231 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief      Contains implementations of triangle counting and clustering
+///             coefficients for undirected graphs.
+/// \author     Sergey Shershakov
+/// \version    0.1.0
+/// \date       18.10.2026
+/// \copyright  © Sergey Shershakov 2020.
+///             This code is for educational purposes of the course "Algorithms
+///             and Data Structures" provided by the Faculty of Computer Science
+///             at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UGRAPH_TRIANGLES_HPP
+#define UGRAPH_TRIANGLES_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include "bit_utils.hpp"
+#include "csr_ugraph.hpp"
+#include "par_utils.hpp"
+
+
+/// Result of triangle counting.
+struct TriangleCounts {
+    /// Total number of triangles in a graph.
+    std::uint64_t total;
+
+    /// Number of triangles every vertex (by dense id) belongs to.
+    std::vector<std::uint64_t> perVertex;
+};
+
+
+namespace triangles_details {
+
+/// \brief Calls f(x) for every x that is in both sorted arrays \a a and \a b
+/// of unique values; uses an 8x8 all-pairs AVX2 kernel when the compiler
+/// targets AVX2 (GRAPH_ENABLE_AVX2 in CMake).
+template <typename F>
+void intersectSorted(const std::uint32_t* a, size_t na,
+                     const std::uint32_t* b, size_t nb, F f)
+{
+    size_t i = 0, j = 0;
+
+#if defined(__AVX2__)
+    const __m256i rot = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+    while(i + 8 <= na && j + 8 <= nb)
+    {
+        __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j));
+
+        // compares the block of a with all 8 rotations of the block of b
+        __m256i eq = _mm256_cmpeq_epi32(va, vb);
+        for(int k = 1; k < 8; ++k)
+        {
+            vb = _mm256_permutevar8x32_epi32(vb, rot);
+            eq = _mm256_or_si256(eq, _mm256_cmpeq_epi32(va, vb));
+        }
+
+        unsigned mask = static_cast<unsigned>(
+                    _mm256_movemask_ps(_mm256_castsi256_ps(eq)));
+        for(; mask; mask &= mask - 1)
+            f(a[i + bits::countTrailingZeros(mask)]);
+
+        std::uint32_t amax = a[i + 7], bmax = b[j + 7];
+        if(amax <= bmax)
+            i += 8;
+        if(bmax <= amax)
+            j += 8;
+    }
+#endif // __AVX2__
+
+    // scalar merge for the rest
+    while(i < na && j < nb)
+    {
+        if(a[i] < b[j])
+            ++i;
+        else if(b[j] < a[i])
+            ++j;
+        else
+        {
+            f(a[i]);
+            ++i;
+            ++j;
+        }
+    }
+}
+
+} // namespace triangles_details
+
+
+/// \brief Counts triangles of the graph \a g on \a threadsNum threads.
+///
+/// Vertices are ranked by degree and every edge is oriented from the lower
+/// rank to the higher one, so every triangle is found exactly once by
+/// intersecting two sorted out-lists, and no out-list is longer than
+/// O(sqrt(E)). Self-loops are ignored. Every thread keeps its own per-vertex
+/// counters, which are summed up at the end.
+///
+/// \tparam TGraph is a graph type with dense ids, such as CsrUGraph.
+template <typename TGraph>
+TriangleCounts countTriangles(const TGraph& g, unsigned threadsNum = 0)
+{
+    typedef typename TGraph::VId VId;
+    static_assert(sizeof(VId) == sizeof(std::uint32_t),
+                  "32-bit dense vertex ids are expected");
+
+    const size_t n = g.getVerticesNum();
+    threadsNum = par::getThreadsNum(threadsNum);
+
+    // orders vertices by degree, ties broken by id
+    std::vector<VId> order(n);
+    std::iota(order.begin(), order.end(), VId(0));
+    std::sort(order.begin(), order.end(), [&g](VId x, VId y)
+    {
+        size_t dx = g.getDegree(x), dy = g.getDegree(y);
+        return dx < dy || (dx == dy && x < y);
+    });
+
+    std::vector<VId> rank(n);
+    par::parallelFor(n, threadsNum, [&](size_t r, unsigned)
+    {
+        rank[order[r]] = static_cast<VId>(r);
+    }, 1 << 14);
+
+    // builds sorted out-lists over ranks
+    std::vector<size_t> offs(n + 1, 0);
+    par::parallelFor(n, threadsNum, [&](size_t r, unsigned)
+    {
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(order[r]);
+        size_t c = 0;
+        for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+            if(rank[*it] > r)
+                ++c;
+        offs[r + 1] = c;
+    });
+    for(size_t r = 0; r < n; ++r)
+        offs[r + 1] += offs[r];
+
+    std::vector<VId> out(offs[n]);
+    par::parallelFor(n, threadsNum, [&](size_t r, unsigned)
+    {
+        typename TGraph::AdjIterPair adj = g.getAdjVertices(order[r]);
+        size_t pos = offs[r];
+        for(typename TGraph::AdjIter it = adj.first; it != adj.second; ++it)
+            if(rank[*it] > r)
+                out[pos++] = rank[*it];
+        std::sort(out.begin() + offs[r], out.begin() + offs[r + 1]);
+    }, 256);
+
+    // intersects out-lists along every oriented edge
+    std::vector<std::vector<std::uint64_t>> local(threadsNum);
+    par::parallelFor(n, threadsNum, [&](size_t r, unsigned tid)
+    {
+        std::vector<std::uint64_t>& cnt = local[tid];
+        if(cnt.empty())
+            cnt.assign(n, 0);
+
+        const VId* outR = out.data() + offs[r];
+        size_t degR = offs[r + 1] - offs[r];
+        for(size_t k = 0; k < degR; ++k)
+        {
+            VId s = outR[k];
+            std::uint64_t found = 0;
+            triangles_details::intersectSorted(outR, degR,
+                        out.data() + offs[s], offs[s + 1] - offs[s],
+                        [&](std::uint32_t t)
+            {
+                ++cnt[t];
+                ++found;
+            });
+            cnt[r] += found;
+            cnt[s] += found;
+        }
+    }, 64);
+
+    // sums counters up, mapping ranks back to dense ids
+    TriangleCounts res;
+    res.perVertex.assign(n, 0);
+    par::parallelFor(n, threadsNum, [&](size_t r, unsigned)
+    {
+        std::uint64_t c = 0;
+        for(const std::vector<std::uint64_t>& cnt : local)
+            if(!cnt.empty())
+                c += cnt[r];
+        res.perVertex[order[r]] = c;
+    }, 1 << 12);
+
+    std::uint64_t sum = 0;
+    for(std::uint64_t c : res.perVertex)
+        sum += c;
+    res.total = sum / 3;
+
+    return res;
+}
+
+
+/// \brief Computes local clustering coefficients of all the vertices of the
+/// graph \a g given its triangle counts \a tc.
+///
+/// The coefficient of a vertex v of degree d (without a self-loop) is
+/// 2 * T(v) / (d * (d - 1)), or 0 if d < 2.
+template <typename TGraph>
+std::vector<double> getClusteringCoefficients(const TGraph& g,
+                                              const TriangleCounts& tc)
+{
+    typedef typename TGraph::VId VId;
+
+    std::vector<double> res(g.getVerticesNum(), 0.0);
+    for(VId v = 0; v < res.size(); ++v)
+    {
+        double d = static_cast<double>(g.getDegree(v) - (g.hasSelfLoop(v) ? 1 : 0));
+        if(d >= 2)
+            res[v] = 2.0 * static_cast<double>(tc.perVertex[v]) / (d * (d - 1));
+    }
+
+    return res;
+}
+
+
+#endif // UGRAPH_TRIANGLES_HPP
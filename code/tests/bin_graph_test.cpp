@@ -0,0 +1,208 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for the binary graph files.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+#include "grio/bin_graph.hpp"
+#include "ugraph/ugraph_bfs.hpp"
+#include "ugraph/ugraph_paths.hpp"
+#include "ugraph/ugraph_reorder.hpp"
+
+
+template <typename TGraph1, typename TGraph2>
+static void expectSameCsr(const TGraph1& exp, const TGraph2& g)
+{
+    typedef typename TGraph1::VId VId;
+    ASSERT_EQ(exp.getVerticesNum(), g.getVerticesNum());
+    EXPECT_EQ(exp.getEdgesNum(), g.getEdgesNum());
+    for(VId v = 0; v < exp.getVerticesNum(); ++v)
+    {
+        EXPECT_EQ(exp.getVertex(v), g.getVertex(v));
+        VId id;
+        EXPECT_TRUE(g.getVId(exp.getVertex(v), id));
+        EXPECT_EQ(v, id);
+        ASSERT_EQ(exp.getDegree(v), g.getDegree(v));
+        EXPECT_EQ(exp.getAdjOffset(v), g.getAdjOffset(v));
+        EXPECT_TRUE(std::equal(exp.getAdjVertices(v).first, exp.getAdjVertices(v).second,
+                               g.getAdjVertices(v).first));
+    }
+}
+
+static void writeFile(const char* fn, const std::string& content)
+{
+    std::ofstream out(fn, std::ios::binary);
+    out << content;
+}
+
+static std::string readFile(const char* fn)
+{
+    std::ifstream in(fn, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+TEST(BinGraph, labeled)
+{
+    EdgeLblUGraph<int, double> g;
+    g.addLblEdge(-5, 3, 0.5);
+    g.addLblEdge(3, 7, 1.5);
+    g.addEdge(7, 7);
+    g.addLblEdge(7, 100, 2.0);
+    g.addVertex(42);
+    CsrEdgeLblUGraph<int, double> csr(g, 9.0);
+
+    const char* fn = "bin_graph_test.bin";
+    saveBinGraph(fn, g, 9.0);
+
+    BinEdgeLblUGraphView<int, double> view(fn, true);
+    expectSameCsr(csr, view);
+    EXPECT_TRUE(view.verify());
+    for(unsigned v = 0; v < csr.getVerticesNum(); ++v)
+        EXPECT_TRUE(std::equal(csr.getAdjLabels(v), csr.getAdjLabels(v) + csr.getDegree(v),
+                               view.getAdjLabels(v)));
+    EXPECT_TRUE(view.hasSelfLoop(2));       // vertex 7
+    unsigned id;
+    EXPECT_FALSE(view.getVId(4, id));
+
+    // algorithms run on the view
+    BinEdgeLblUGraphView<int, double> copy = view;
+    EXPECT_EQ(findShortestPathsDijkstra(csr, 0).dists,
+              findShortestPathsDijkstra(copy, 0).dists);
+
+    // a labeled file can be opened without labels
+    BinUGraphView<int> plain(fn);
+    expectSameCsr(csr, plain);
+
+    // wrong types
+    EXPECT_THROW((BinEdgeLblUGraphView<int, float>(fn)), std::invalid_argument);
+    EXPECT_THROW((BinUGraphView<long long>(fn)), std::invalid_argument);
+    std::remove(fn);
+}
+
+TEST(BinGraph, denseIds)
+{
+    // vertices 0..n-1 are stored without a dictionary
+    UGraph<unsigned> g;
+    for(unsigned i = 0; i < 1000; ++i)
+        g.addEdge(i, (i * 37 + 11) % 1000);
+    CsrUGraph<unsigned> csr(g);
+
+    const char* fn = "bin_graph_test.bin";
+    saveBinGraph(fn, csr);
+    std::string content = readFile(fn);
+
+    UGraph<unsigned> g2 = g;
+    g2.addVertex(5000);
+    saveBinGraph(fn, g2);
+    EXPECT_GT(readFile(fn).size(), content.size() + 1000 * sizeof(unsigned));
+
+    writeFile(fn, content);
+    BinUGraphView<unsigned> view(fn, true);
+    expectSameCsr(csr, view);
+    unsigned id;
+    EXPECT_FALSE(view.getVId(1000, id));
+    EXPECT_EQ(findBfsDistances(csr, 5), findBfsDistances(view, 5));
+    EXPECT_THROW((BinEdgeLblUGraphView<unsigned, int>(fn)), std::invalid_argument);
+
+    // empty graphs
+    saveBinGraph(fn, UGraph<unsigned>());
+    BinUGraphView<unsigned> empty(fn, true);
+    EXPECT_EQ(0, empty.getVerticesNum());
+    saveBinGraph(fn, EdgeLblUGraph<unsigned, int>());
+    BinEdgeLblUGraphView<unsigned, int> emptyLbl(fn, true);
+    EXPECT_EQ(0, emptyLbl.getEdgesNum());
+    std::remove(fn);
+}
+
+TEST(BinGraph, reordered)
+{
+    // a reordered graph keeps its vertex index
+    UGraph<unsigned> g;
+    for(unsigned i = 0; i < 1000; ++i)
+        g.addEdge(i, (i * 37 + 11) % 1000);
+    CsrUGraph<unsigned> csr(g);
+    CsrUGraph<unsigned> r(csr, findRcmOrder(csr));
+    ASSERT_FALSE(r.getVertexIndex().empty());
+
+    const char* fn = "bin_graph_test.bin";
+    saveBinGraph(fn, r);
+    {
+        BinUGraphView<unsigned> view(fn, true);
+        expectSameCsr(r, view);
+        unsigned id;
+        EXPECT_FALSE(view.getVId(1000, id));
+    }
+    std::string content = readFile(fn);
+    EXPECT_EQ(2, content[4]);                   // the version with the index
+    content[4] = 1;
+    writeFile(fn, content);
+    EXPECT_THROW((BinUGraphView<unsigned>(fn)), std::invalid_argument);
+    std::remove(fn);
+}
+
+TEST(BinGraph, broken)
+{
+    EdgeLblUGraph<int, int> g;
+    for(int i = 0; i < 300; ++i)
+        g.addLblEdge(i * 3, (i * 7) % 200, i);
+
+    const char* fn = "bin_graph_test.bin";
+    saveBinGraph(fn, g);
+    std::string content = readFile(fn);
+    EXPECT_EQ(1, content[4]);                   // no index, the first version
+
+    // a corrupted byte is found by the checksum only
+    std::string bad = content;
+    bad[bad.size() / 2] ^= 1;
+    writeFile(fn, bad);
+    {
+        BinEdgeLblUGraphView<int, int> view(fn);
+        EXPECT_FALSE(view.verify());
+    }
+    EXPECT_THROW((BinEdgeLblUGraphView<int, int>(fn, true)), std::invalid_argument);
+
+    // decreasing offsets of the adjacency lists, right after the header
+    bad = content;
+    bad[128 + 8 + 7] = 1;
+    writeFile(fn, bad);
+    EXPECT_THROW((BinEdgeLblUGraphView<int, int>(fn)), std::invalid_argument);
+
+    // truncated, another version, another byte order, not a graph
+    writeFile(fn, content.substr(0, content.size() - 4));
+    EXPECT_THROW((BinEdgeLblUGraphView<int, int>(fn)), std::invalid_argument);
+    bad = content;
+    bad[4] = 3;
+    writeFile(fn, bad);
+    EXPECT_THROW((BinEdgeLblUGraphView<int, int>(fn)), std::invalid_argument);
+    bad = content;
+    std::swap(bad[0], bad[3]);
+    std::swap(bad[1], bad[2]);
+    writeFile(fn, bad);
+    try
+    {
+        BinEdgeLblUGraphView<int, int> v(fn);
+        FAIL();
+    }
+    catch(const std::invalid_argument& e)
+    {
+        EXPECT_NE(std::string::npos, std::string(e.what()).find("byte order"));
+    }
+    writeFile(fn, "graph G {}");
+    EXPECT_THROW((BinUGraphView<int>(fn)), std::invalid_argument);
+    std::remove(fn);
+    EXPECT_THROW((BinUGraphView<int>(fn)), std::invalid_argument);
+}
@@ -0,0 +1,158 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for graphs with compressed adjacency lists.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include "ugraph/compressed_ugraph.hpp"
+#include "ugraph/ugraph_bfs.hpp"
+#include "ugraph/ugraph_components.hpp"
+
+
+typedef UGraph<int> IntGraph;
+typedef CsrUGraph<int> IntCsrGraph;
+typedef CompressedUGraph<int> IntCompGraph;
+
+/// A random graph with local edges, far edges, a hub, self-loops and
+/// isolated vertices.
+static IntGraph makeGraph(int n, unsigned seed)
+{
+    IntGraph g;
+    std::mt19937 rnd(seed);
+    std::uniform_int_distribution<int> pick(0, n - 1);
+    std::uniform_int_distribution<int> near(-20, 20);
+    for(int i = 0; i < n; ++i)
+        g.addVertex(i * 3);
+    for(int i = 0; i < n * 3; ++i)
+    {
+        int s = pick(rnd);
+        int d = std::min(n - 1, std::max(0, s + near(rnd)));
+        g.addEdge(s * 3, d * 3);
+    }
+    for(int i = 0; i < n / 4; ++i)
+        g.addEdge(pick(rnd) * 3, pick(rnd) * 3);
+    for(int i = 0; i < n; i += 3)
+        g.addEdge(n / 2 * 3, i * 3);        // a hub of many blocks
+
+    return g;
+}
+
+static void expectSameAdj(const IntCsrGraph& csr, const IntCompGraph& cg)
+{
+    ASSERT_EQ(csr.getVerticesNum(), cg.getVerticesNum());
+    EXPECT_EQ(csr.getEdgesNum(), cg.getEdgesNum());
+    for(IntCsrGraph::VId v = 0; v < csr.getVerticesNum(); ++v)
+    {
+        EXPECT_EQ(csr.getVertex(v), cg.getVertex(v));
+        ASSERT_EQ(csr.getDegree(v), cg.getDegree(v));
+        IntCsrGraph::AdjIterPair exp = csr.getAdjVertices(v);
+        IntCompGraph::AdjIterPair adj = cg.getAdjVertices(v);
+        ASSERT_EQ(std::vector<std::uint32_t>(exp.first, exp.second),
+                  std::vector<std::uint32_t>(adj.first, adj.second)) << v;
+        EXPECT_EQ(csr.hasSelfLoop(v), cg.hasSelfLoop(v));
+    }
+}
+
+
+TEST(CompressedUGraph, simple)
+{
+    IntGraph g;
+    g.addEdge(1, 2);
+    g.addEdge(1, 3);
+    g.addEdge(3, 3);
+    g.addVertex(7);
+
+    IntCompGraph cg(g);
+    EXPECT_EQ(4, cg.getVerticesNum());
+    EXPECT_EQ(3, cg.getEdgesNum());
+
+    IntCompGraph::VId v;
+    EXPECT_TRUE(cg.getVId(3, v));
+    EXPECT_EQ(2, v);
+    EXPECT_EQ(3, cg.getVertex(v));
+    EXPECT_EQ(2, cg.getDegree(v));      // {1, 3} and a self-loop once
+    EXPECT_TRUE(cg.hasSelfLoop(v));
+    EXPECT_FALSE(cg.getVId(5, v));
+
+    IntCompGraph::AdjIterPair adj = cg.getAdjVertices(0);
+    ASSERT_EQ(2, std::distance(adj.first, adj.second));
+    EXPECT_EQ(1, *adj.first++);         // vertex 2
+    EXPECT_EQ(2, *adj.first);           // vertex 3
+    EXPECT_TRUE(cg.hasEdge(0, 2));
+    EXPECT_FALSE(cg.hasEdge(0, 3));
+    EXPECT_EQ(0, cg.getDegree(3));
+    adj = cg.getAdjVertices(3);
+    EXPECT_TRUE(adj.first == adj.second);
+
+    IntCompGraph e;
+    EXPECT_EQ(0, e.getVerticesNum());
+}
+
+TEST(CompressedUGraph, random)
+{
+    IntGraph g = makeGraph(5000, 3);
+    IntCsrGraph csr(g);
+    IntCompGraph cg(g, 3);
+    expectSameAdj(csr, cg);
+    expectSameAdj(csr, IntCompGraph(csr, 1));
+
+    // local edges take a byte each
+    EXPECT_LT(cg.getDataSize(), csr.getEdgesNum() * 2 * sizeof(std::uint32_t) / 2);
+
+    // random access by skip pointers, including the hub
+    std::mt19937 rnd(7);
+    std::uniform_int_distribution<std::uint32_t> pick(0, 4999);
+    IntCsrGraph::VId hub;
+    ASSERT_TRUE(csr.getVId(2500 * 3, hub));
+    ASSERT_GT(cg.getDegree(hub), 20 * compressed_details::BLOCK_SIZE);
+    for(int i = 0; i < 20000; ++i)
+    {
+        IntCsrGraph::VId v = i % 2 ? hub : pick(rnd), u = pick(rnd);
+        IntCsrGraph::AdjIterPair adj = csr.getAdjVertices(v);
+        IntCsrGraph::AdjIter exp = std::lower_bound(adj.first, adj.second, u);
+        IntCompGraph::AdjIter it = cg.findAdjVertex(v, u);
+        ASSERT_EQ(exp == adj.second, it == IntCompGraph::AdjIter());
+        if(exp != adj.second)
+        {
+            ASSERT_EQ(*exp, *it);
+            ASSERT_EQ(adj.second - exp, std::distance(it, IntCompGraph::AdjIter()));
+        }
+        ASSERT_EQ(std::binary_search(adj.first, adj.second, u), cg.hasEdge(v, u));
+    }
+}
+
+TEST(CompressedUGraph, algorithms)
+{
+    IntGraph g = makeGraph(3000, 5);
+    for(int i = 0; i < 50; ++i)
+        g.addEdge(20000 + i, 20000 + i + 1);     // another component
+    IntCsrGraph csr(g);
+    IntCompGraph cg(csr);
+
+    EXPECT_EQ(findBfsDistances(csr, 17), findBfsDistances(cg, 17));
+
+    std::vector<std::uint32_t> sources;
+    for(std::uint32_t s = 0; s < 300; s += 7)
+        sources.push_back(s);
+    sources.push_back(static_cast<std::uint32_t>(csr.getVerticesNum() - 1));
+    EXPECT_EQ(findMultiSourceBfsDistances(csr, sources, 2).dists,
+              findMultiSourceBfsDistances(cg, sources, 2).dists);
+
+    auto exp = findComponentsAfforest(csr, 2);
+    auto cc = findComponentsAfforest(cg, 2);
+    EXPECT_EQ(exp.compIds, cc.compIds);
+    EXPECT_EQ(exp.compSizes, cc.compSizes);
+}
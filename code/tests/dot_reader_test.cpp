@@ -0,0 +1,249 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for the DOT-reader for labeled graphs.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "grviz/dot_reader.hpp"
+#include "grviz/ugraph_dotwriter.hpp"
+#include "graph_test_utils.hpp"
+
+
+typedef EdgeLblUGraph<int, int> IntIntGraph;
+
+template <typename Vertex, typename EdgeLbl>
+static std::string writeDot(const EdgeLblUGraph<Vertex, EdgeLbl>& g)
+{
+    typename EdgeLblUGraphDotWriter<Vertex, EdgeLbl>::Type dw;
+    std::stringstream str;
+    dw.write(str, g, "Test Graph");
+
+    return str.str();
+}
+
+template <typename Vertex, typename EdgeLbl>
+static void readDot(const std::string& s, EdgeLblUGraph<Vertex, EdgeLbl>& g,
+                    size_t batchSize = 1 << 16)
+{
+    EdgeLblUGraphDotReader<Vertex, EdgeLbl> rd(batchSize);
+    rd.read(s.data(), s.size(), g);
+}
+
+template <typename Vertex, typename EdgeLbl>
+static void expectSameGraphs(const EdgeLblUGraph<Vertex, EdgeLbl>& exp,
+                             const EdgeLblUGraph<Vertex, EdgeLbl>& g)
+{
+    std::vector<Vertex> ev(exp.getVertices().first, exp.getVertices().second);
+    std::vector<Vertex> gv(g.getVertices().first, g.getVertices().second);
+    EXPECT_EQ(ev, gv);
+    for(const Vertex& v : ev)
+        EXPECT_EQ(exp.getDegree(v), g.getDegree(v));
+    EXPECT_EQ(getEdges(exp), getEdges(g));
+}
+
+
+TEST(DotReader, roundTrip)
+{
+    IntIntGraph g;
+    g.addLblEdge(1, 2, 10);
+    g.addLblEdge(-7, 3, INT_MIN);
+    g.addEdge(1, 4);
+    g.addLblEdge(4, 4, INT_MAX);
+    g.addEdge(5, 5);
+    g.addVertex(100);
+
+    // the result of the writer, read by small batches too; the order of
+    // edges of a vertex may change once
+    std::string dot = writeDot(g);
+    for(size_t batchSize : {1u, 2u, 1000u})
+    {
+        IntIntGraph r, r2;
+        readDot(dot, r, batchSize);
+        expectSameGraphs(g, r);
+        std::string dot2 = writeDot(r);
+        readDot(dot2, r2, batchSize);
+        EXPECT_EQ(dot2, writeDot(r2));
+    }
+
+    EdgeLblUGraphDotReader<int, int> rd;
+    IntIntGraph r;
+    rd.read(dot.data(), dot.size(), r);
+    EXPECT_EQ("Test Graph", rd.getLabel());
+}
+
+TEST(DotReader, roundTripTypes)
+{
+    EdgeLblUGraph<char, std::string> g1;
+    g1.addLblEdge('a', 'b', "say \"hi\"");
+    g1.addLblEdge('b', 'c', "back\\slash\\");
+    g1.addLblEdge('c', 'a', "");
+    g1.addEdge('d', 'a');
+    EdgeLblUGraph<char, std::string> r1;
+    readDot(writeDot(g1), r1);
+    expectSameGraphs(g1, r1);
+
+    EdgeLblUGraph<long long, double> g2;
+    g2.addLblEdge(-5000000000LL, 3, 0.5);
+    g2.addLblEdge(3, 4, -1e300);
+    g2.addLblEdge(4, 5, 12345.5);   // the writer keeps 6 digits
+    EdgeLblUGraph<long long, double> r2;
+    readDot(writeDot(g2), r2);
+    expectSameGraphs(g2, r2);
+
+    EdgeLblUGraph<std::string, unsigned> g3;
+    g3.addLblEdge("alpha", "beta_2", 4000000000u);
+    g3.addEdge("beta_2", "gamma");
+    EdgeLblUGraph<std::string, unsigned> r3;
+    readDot(writeDot(g3), r3);
+    expectSameGraphs(g3, r3);
+}
+
+TEST(DotReader, largeFile)
+{
+    IntIntGraph g;
+    unsigned x = 1;
+    for(int i = 0; i < 20000; ++i)
+    {
+        x = x * 1103515245u + 12345u;
+        int s = static_cast<int>(x >> 8) % 3000;
+        x = x * 1103515245u + 12345u;
+        int d = static_cast<int>(x >> 8) % 3000;
+        if(i % 4 == 0)
+            g.addEdge(s, d);
+        else
+            g.addLblEdge(s, d, -i);
+    }
+
+    EdgeLblUGraphDotWriter<int, int>::Type dw;
+    dw.write(GV_OUT_DIR "dot_reader_test.gv", g, "Large");
+
+    IntIntGraph r;
+    EdgeLblUGraphDotReader<int, int> rd(1000);
+    rd.read(GV_OUT_DIR "dot_reader_test.gv", r);
+    expectSameGraphs(g, r);
+    EXPECT_EQ("Large", rd.getLabel());
+    std::remove(GV_OUT_DIR "dot_reader_test.gv");
+}
+
+TEST(DotReader, samples)
+{
+    IntIntGraph g;
+    EdgeLblUGraphDotReader<int, int> rd;
+    rd.read(GV_SAMPLES_DIR "gr3.gv", g);
+    IntIntGraph exp;
+    exp.addLblEdge(1, 2, 10);
+    exp.addLblEdge(1, 3, 20);
+    exp.addLblEdge(1, 4, 30);
+    exp.addLblEdge(2, 4, 40);
+    expectSameGraphs(exp, g);
+
+    // directed graphs are not read
+    IntIntGraph dg;
+    EXPECT_THROW(rd.read(GV_SAMPLES_DIR "digr2.gv", dg), std::invalid_argument);
+    EXPECT_THROW(rd.read(GV_SAMPLES_DIR "of1-2.gv", dg), std::invalid_argument);
+
+    EdgeLblUGraph<int, std::string> sg;
+    EdgeLblUGraphDotReader<int, std::string> srd;
+    srd.read(GV_SAMPLES_DIR "gr2.gv", sg);
+    EdgeLblUGraph<int, std::string> sexp;
+    sexp.addLblEdge(1, 2, "a");
+    sexp.addLblEdge(1, 3, "b");
+    sexp.addLblEdge(1, 4, "c");
+    sexp.addLblEdge(2, 4, "d");
+    expectSameGraphs(sexp, sg);
+
+    // string labels are not numbers
+    IntIntGraph ig;
+    EXPECT_THROW(rd.read(GV_SAMPLES_DIR "gr2.gv", ig), std::invalid_argument);
+}
+
+TEST(DotReader, syntax)
+{
+    // the subset beyond the output of the writer
+    const char* dot =
+        "# preprocessor line\n"
+        "/* comment */ GRAPH \"my graph\" {\n"
+        "  graph [rankdir=LR]; node [shape=box, width=0.5]\n"
+        "  edge [color=red]\n"
+        "  label = Plain\n"
+        "  1 [label=\"ignored\"]; 2\n"
+        "  1 -- 2 -- 3 [color=blue, label=7] [weight=2];  // trailing\n"
+        "  3--4\n"
+        "  \"5\" -- -6 [label=\"-8\"]\n"
+        "}\n";
+    IntIntGraph r;
+    EdgeLblUGraphDotReader<int, int> rd;
+    rd.read(dot, std::strlen(dot), r);
+
+    IntIntGraph g;
+    g.addLblEdge(1, 2, 7);
+    g.addLblEdge(2, 3, 7);
+    g.addEdge(3, 4);
+    g.addLblEdge(5, -6, -8);
+    expectSameGraphs(g, r);
+    EXPECT_EQ("Plain", rd.getLabel());
+
+    IntIntGraph e;
+    readDot("graph {}", e);
+    EXPECT_EQ(0, e.getVerticesNum());
+}
+
+TEST(DotReader, errors)
+{
+    const char* bad[] = {
+        "",
+        "digraph G { 1 -> 2 }",
+        "strict graph G { }",
+        "graph G { 1 -> 2 }",
+        "graph G { 1 -- 2",
+        "graph G { 1 -- 2 } 3",
+        "graph G { subgraph s { 1 } }",
+        "graph G { 1 -- { 2 3 } }",
+        "graph G { 1 -- }",
+        "graph G { 1:p -- 2 }",
+        "graph G { x -- 2 }",
+        "graph G { 99999999999 }",
+        "graph G { 1 -- 2 [label=\"x\"] }",
+        "graph G { 1 -- 2 [label=] }",
+        "graph G { 1 -- 2 [label=\"1] }",
+        "graph G { node }",
+        "graph G { /* 1 }",
+        "graph G { 1 -- 2 [label=<b>] }",
+    };
+    for(const char* dot : bad)
+    {
+        IntIntGraph r;
+        EXPECT_THROW(readDot(dot, r), std::invalid_argument) << dot;
+    }
+
+    IntIntGraph r;
+    try
+    {
+        readDot("graph G {\n 1 -- 2\n 3 -> 4\n}", r);
+        FAIL();
+    }
+    catch(const std::invalid_argument& e)
+    {
+        EXPECT_NE(std::string::npos, std::string(e.what()).find("line 3"));
+    }
+
+    EdgeLblUGraphDotReader<int, int> rd;
+    EXPECT_THROW(rd.read("no_such_file.gv", r), std::invalid_argument);
+}
@@ -0,0 +1,206 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for the loader of edge-list text files.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include "grio/edgelist_reader.hpp"
+
+
+typedef UGraph<int> IntGraph;
+typedef EdgeLblUGraph<unsigned, double> UDblGraph;
+
+/// Edges of a graph in a canonical order, with labels.
+static std::vector<std::pair<std::pair<unsigned, unsigned>, double>>
+getEdges(const UDblGraph& g)
+{
+    std::vector<std::pair<std::pair<unsigned, unsigned>, double>> res;
+    for(UDblGraph::EdgeIter it = g.getEdges().first; it != g.getEdges().second; ++it)
+    {
+        double lbl = -1;
+        g.getLabel(it->first, it->second, lbl);
+        res.push_back({{it->first, it->second}, lbl});
+    }
+    std::sort(res.begin(), res.end());
+
+    return res;
+}
+
+TEST(EdgeListReader, simple)
+{
+    std::string text =
+        "# Directed graph (each unordered pair of nodes is saved once)\n"
+        "% a comment too\n"
+        "1\t2\n"
+        "\n"
+        "  3 1 17 1234567890\r\n"
+        "2 2\n"
+        "1 2\n"
+        "-4 5";
+    IntGraph g;
+    readEdgeList(text.data(), text.size(), g);
+
+    EXPECT_EQ(4, g.getEdgesNum());
+    EXPECT_EQ(5, g.getVerticesNum());
+    EXPECT_TRUE(g.isEdgeExists(2, 1));
+    EXPECT_TRUE(g.isEdgeExists(1, 3));
+    EXPECT_TRUE(g.isEdgeExists(2, 2));
+    EXPECT_TRUE(g.isEdgeExists(5, -4));
+    EXPECT_EQ(2, g.getDegree(1));
+    EXPECT_EQ(2, g.getDegree(2));
+
+    IntGraph e;
+    readEdgeList("", 0, e);
+    EXPECT_EQ(0, e.getVerticesNum());
+}
+
+TEST(EdgeListReader, labels)
+{
+    std::string text =
+        "0 1 0.5\n"
+        "1 2\n"
+        "2 3 -1.25e3\n"
+        "1 0 7\n"             // repeated: the first label stays
+        "3 4 1e-300 extra\n"
+        "4 5 12345678901234567890\n";
+    UDblGraph g;
+    readLblEdgeList(text.data(), text.size(), g);
+
+    std::vector<std::pair<std::pair<unsigned, unsigned>, double>> exp = {
+        {{0, 1}, 0.5}, {{1, 2}, -1}, {{2, 3}, -1250}, {{3, 4}, 1e-300},
+        {{4, 5}, 12345678901234567890.0}
+    };
+    EXPECT_EQ(exp, getEdges(g));
+}
+
+// Many parts on several threads give the same graph as adding edges one by one.
+TEST(EdgeListReader, parallel)
+{
+    std::stringstream text;
+    UDblGraph exp;
+    unsigned x = 1;
+    for(int i = 0; i < 200000; ++i)
+    {
+        x = x * 1103515245u + 12345u;
+        unsigned s = (x >> 8) % 20000;
+        x = x * 1103515245u + 12345u;
+        unsigned d = (x >> 8) % 20000;
+        if(i % 3 == 0)
+        {
+            text << s << ' ' << d << '\n';
+            exp.addEdge(s, d);
+        }
+        else
+        {
+            double lbl = (i % 4000) / 4.0;      // printed exactly
+            text << s << '\t' << d << '\t' << lbl << '\n';
+            exp.addLblEdge(s, d, lbl);
+        }
+    }
+    std::string str = text.str();
+    ASSERT_GT(str.size(), 2u << 20);        // at least two parts
+
+    for(unsigned threads : {1u, 3u, 8u})
+    {
+        UDblGraph g;
+        readLblEdgeList(str.data(), str.size(), g, threads);
+        EXPECT_EQ(exp.getVerticesNum(), g.getVerticesNum());
+        EXPECT_EQ(exp.getEdgesNum(), g.getEdgesNum());
+        EXPECT_EQ(getEdges(exp), getEdges(g));
+        for(UDblGraph::VertexIter it = exp.getVertices().first;
+            it != exp.getVertices().second; ++it)
+            ASSERT_EQ(exp.getDegree(*it), g.getDegree(*it));
+    }
+
+    // through a file
+    const char* fn = "edgelist_reader_test.txt";
+    {
+        std::ofstream out(fn, std::ios::binary);
+        out << str;
+    }
+    UDblGraph g;
+    readLblEdgeList(fn, g, 2);
+    EXPECT_EQ(getEdges(exp), getEdges(g));
+
+    UGraph<unsigned> ug;
+    readEdgeList(fn, ug, 2);
+    EXPECT_EQ(exp.getEdgesNum(), ug.getEdgesNum());
+    std::remove(fn);
+}
+
+TEST(EdgeListReader, errors)
+{
+    const char* bad[] = {
+        "1\n",
+        "1 2\n3\n",
+        "1 x\n",
+        "1 2.5\n",
+        "1 99999999999\n",
+        "1 2 abc\n",
+        "1 2 1.5.5\n",
+    };
+    for(const char* text : bad)
+    {
+        UDblGraph g;
+        EXPECT_THROW(readLblEdgeList(text, std::strlen(text), g), std::invalid_argument)
+            << text;
+        EXPECT_EQ(0, g.getEdgesNum());
+    }
+
+    UGraph<unsigned> g;
+    const char* text = "1 2\n-1 2\n";
+    try
+    {
+        readEdgeList(text, std::strlen(text), g);
+        FAIL();
+    }
+    catch(const std::invalid_argument& e)
+    {
+        EXPECT_NE(std::string::npos, std::string(e.what()).find("line 2"));
+    }
+
+    // extra fields are ignored for unlabeled graphs
+    text = "1 2 abc\n";
+    readEdgeList(text, std::strlen(text), g);
+    EXPECT_EQ(1, g.getEdgesNum());
+
+    EXPECT_THROW(readEdgeList("no_such_file.txt", g), std::invalid_argument);
+}
+
+TEST(EdgeListReader, parseFloat)
+{
+    const char* nums[] = {"0", "-0.0", "1", "0.1", "3.14159", "-2.5e-3", "1e22",
+                          "123456789012345", "1.7976931348623157e308", "4.9e-324",
+                          "0.30000000000000004", "+7.", ".5", "1E5"};
+    for(const char* s : nums)
+    {
+        double v = 0;
+        EXPECT_TRUE(parse::parseFloat(s, s + std::strlen(s), v)) << s;
+        EXPECT_EQ(std::strtod(s, nullptr), v) << s;
+    }
+
+    const char* bad[] = {"", "-", ".", "1e", "e5", "1x", " 1", "1 "};
+    for(const char* s : bad)
+    {
+        double v;
+        EXPECT_FALSE(parse::parseFloat(s, s + std::strlen(s), v)) << s;
+    }
+}
@@ -0,0 +1,54 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Helpers shared by the testing modules of graph readers.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef GRAPH_TEST_UTILS_HPP
+#define GRAPH_TEST_UTILS_HPP
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "ugraph/lbl_ugraph.hpp"
+
+
+/// Edges of a graph in a canonical order, with labels.
+template <typename Vertex, typename EdgeLbl>
+std::vector<std::pair<std::pair<Vertex, Vertex>, std::pair<bool, EdgeLbl>>>
+getEdges(const EdgeLblUGraph<Vertex, EdgeLbl>& g)
+{
+    typedef EdgeLblUGraph<Vertex, EdgeLbl> Graph;
+    std::vector<std::pair<std::pair<Vertex, Vertex>, std::pair<bool, EdgeLbl>>> res;
+    typename Graph::EdgeIterPair es = g.getEdges();
+    for(typename Graph::EdgeIter it = es.first; it != es.second; ++it)
+    {
+        EdgeLbl lbl = EdgeLbl();
+        bool has = g.getLabel(it->first, it->second, lbl);
+        res.push_back({{it->first, it->second}, {has, lbl}});
+    }
+    std::sort(res.begin(), res.end());
+
+    return res;
+}
+
+/// Edges of an unlabeled graph in a canonical order.
+template <typename Vertex>
+std::vector<std::pair<Vertex, Vertex>> getEdges(const UGraph<Vertex>& g)
+{
+    std::vector<std::pair<Vertex, Vertex>> res(g.getEdges().first, g.getEdges().second);
+    std::sort(res.begin(), res.end());
+
+    return res;
+}
+
+
+#endif // GRAPH_TEST_UTILS_HPP
@@ -58,4 +58,26 @@ TEST(EdgeLblUGraph, getEdgeLabel)
     EXPECT_EQ(40, lbl);
 }
 
+// Tests adding labeled edges by batches.
+TEST(EdgeLblUGraph, addLblEdges1)
+{
+    IntIntGraph g;
+    g.addLblEdge(1, 2, 10);
+    g.addEdge(1, 4);
+    g.addLblEdges({{{3, 1}, 30}, {{2, 1}, 11}, {{4, 1}, 40}, {{1, 3}, 31},
+                   {{5, 5}, 50}});
+
+    int lbl;
+    EXPECT_TRUE(g.getLabel(1, 2, lbl));
+    EXPECT_EQ(10, lbl);                 // labeled already
+    EXPECT_TRUE(g.getLabel(1, 3, lbl));
+    EXPECT_EQ(30, lbl);                 // the first label of the batch
+    EXPECT_TRUE(g.getLabel(4, 1, lbl));
+    EXPECT_EQ(40, lbl);                 // an existing edge gets the label
+    EXPECT_TRUE(g.getLabel(5, 5, lbl));
+    EXPECT_EQ(50, lbl);
 
+    EXPECT_EQ(4, g.getEdgesNum());
+    EXPECT_EQ(3, g.getDegree(1));
+    EXPECT_EQ(1, g.getDegree(5));
+}
@@ -0,0 +1,45 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for memory-mapped files.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+
+#include "grio/mmap_file.hpp"
+
+
+TEST(MappedFile, content)
+{
+    const char* fn = "mmap_file_test.bin";
+    {
+        std::ofstream out(fn, std::ios::binary);
+        out << "hello\0world";
+        out.write("\0\x01", 2);
+    }
+
+    {
+        MappedFile mf(fn);
+        ASSERT_EQ(7u, mf.getSize());
+        EXPECT_EQ(std::string("hello\0\x01", 7), std::string(mf.getData(), mf.getSize()));
+    }
+
+    std::ofstream(fn, std::ios::binary | std::ios::trunc);
+    MappedFile empty(fn);
+    EXPECT_EQ(0u, empty.getSize());
+    EXPECT_EQ(nullptr, empty.getData());
+    std::remove(fn);
+
+    EXPECT_THROW(MappedFile("no/such/file.bin"), std::invalid_argument);
+}
@@ -0,0 +1,261 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for the Matrix Market reader and writer.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "grio/mtx_io.hpp"
+#include "graph_test_utils.hpp"
+
+
+typedef UGraph<unsigned> UIntGraph;
+typedef EdgeLblUGraph<int, double> IntDblGraph;
+
+template <typename Vertex>
+static std::vector<Vertex> getVertices(const UGraph<Vertex>& g)
+{
+    return std::vector<Vertex>(g.getVertices().first, g.getVertices().second);
+}
+
+
+TEST(MtxIO, read)
+{
+    std::string text =
+        "%%MatrixMarket matrix coordinate real symmetric\n"
+        "% a comment\n"
+        "%\n"
+        "\n"
+        "  5 5 5\n"
+        "1 1 2.5\n"
+        "2\t1 -1e-3\r\n"
+        "4 2 1.0E2\n"
+        "% a comment inside\n"
+        "4 3  7\n"
+        "2 1 8";        // the same edge, the first value wins
+
+    IntDblGraph g;
+    readLblMtx(text.data(), text.size(), g);
+    EXPECT_EQ(std::vector<int>({0, 1, 2, 3, 4}), getVertices(g));
+    IntDblGraph exp;
+    exp.addLblEdge(0, 0, 2.5);
+    exp.addLblEdge(1, 0, -1e-3);
+    exp.addLblEdge(3, 1, 100);
+    exp.addLblEdge(3, 2, 7);
+    EXPECT_EQ(getEdges(exp), getEdges(g));
+
+    // values are ignored by the unlabeled reader
+    UIntGraph ug;
+    readMtx(text.data(), text.size(), ug);
+    EXPECT_EQ(5u, ug.getVerticesNum());
+    EXPECT_EQ(4u, ug.getEdgesNum());
+    EXPECT_EQ(2u, ug.getDegree(0));     // a self-loop counts once
+
+    // a general pattern matrix: both triangles make the same edges
+    std::string pattern =
+        "%%matrixmarket MATRIX Coordinate Pattern General\n"
+        "3 3 4\n"
+        "1 2\n"
+        "2 1\n"
+        "3 2\n"
+        "2 3\n";
+    IntDblGraph pg;
+    readLblMtx(pattern.data(), pattern.size(), pg);
+    EXPECT_EQ(3u, pg.getVerticesNum());
+    EXPECT_EQ(2u, pg.getEdgesNum());
+    double lbl;
+    EXPECT_FALSE(pg.getLabel(0, 1, lbl));
+
+    // an integer one into integer labels
+    std::string ints =
+        "%%MatrixMarket matrix coordinate integer symmetric\n"
+        "2 2 1\n"
+        "2 1 -42\n";
+    EdgeLblUGraph<unsigned char, long long> ig;
+    readLblMtx(ints.data(), ints.size(), ig);
+    long long ilbl = 0;
+    EXPECT_TRUE(ig.getLabel(0, 1, ilbl));
+    EXPECT_EQ(-42, ilbl);
+}
+
+TEST(MtxIO, roundTrip)
+{
+    IntDblGraph g;
+    g.addLblEdge(0, 1, 0.1);
+    g.addLblEdge(2, 1, 1.0 / 3);
+    g.addLblEdge(3, 3, -1e300);
+    g.addEdge(5, 0);                    // unlabeled: the default value
+    g.addVertex(9);
+
+    std::stringstream str;
+    writeLblMtx(str, g, 1.5);
+    std::string text = str.str();
+    EXPECT_EQ(0u, text.find("%%MatrixMarket matrix coordinate real symmetric\n"
+                            "10 10 4\n"));
+
+    IntDblGraph r;
+    readLblMtx(text.data(), text.size(), r);
+    g.addLblEdge(5, 0, 1.5);
+    EXPECT_EQ(getEdges(g), getEdges(r));       // exact values
+    EXPECT_EQ(10u, r.getVerticesNum());        // 0..9
+
+    // pattern
+    UIntGraph u;
+    u.addEdge(3, 1);
+    u.addEdge(2, 2);
+    u.addEdge(0, 3);
+    std::stringstream ustr;
+    writeMtx(ustr, u);
+    EXPECT_EQ(0u, ustr.str().find("%%MatrixMarket matrix coordinate pattern symmetric\n"
+                                  "4 4 3\n"));
+    UIntGraph ur;
+    std::string utext = ustr.str();
+    readMtx(utext.data(), utext.size(), ur);
+    EXPECT_EQ(getEdges(u), getEdges(ur));
+    EXPECT_EQ(getVertices(u), getVertices(ur));
+
+    // the empty graph
+    std::stringstream estr;
+    writeMtx(estr, UIntGraph());
+    UIntGraph er;
+    std::string etext = estr.str();
+    readMtx(etext.data(), etext.size(), er);
+    EXPECT_EQ(0u, er.getVerticesNum());
+
+    // integer labels
+    EdgeLblUGraph<unsigned, int> ig;
+    ig.addLblEdge(7, 2, -5);
+    std::stringstream istr;
+    writeLblMtx(istr, ig);
+    EXPECT_EQ("%%MatrixMarket matrix coordinate integer symmetric\n"
+              "8 8 1\n"
+              "8 3 -5\n", istr.str());
+
+    // character labels are numbers too
+    EdgeLblUGraph<int, signed char> cg;
+    cg.addLblEdge(1, 0, 5);
+    cg.addLblEdge(2, 1, -3);
+    std::stringstream cstr;
+    writeLblMtx(cstr, cg);
+    EXPECT_EQ("%%MatrixMarket matrix coordinate integer symmetric\n"
+              "3 3 2\n"
+              "2 1 5\n"
+              "3 2 -3\n", cstr.str());
+    EdgeLblUGraph<int, signed char> cr;
+    std::string ctext = cstr.str();
+    readLblMtx(ctext.data(), ctext.size(), cr);
+    EXPECT_EQ(getEdges(cg), getEdges(cr));
+
+    EdgeLblUGraph<int, unsigned char> ucg;
+    ucg.addLblEdge(0, 0, 200);
+    std::stringstream ucstr;
+    writeLblMtx(ucstr, ucg);
+    EdgeLblUGraph<int, unsigned char> ucr;
+    std::string uctext = ucstr.str();
+    readLblMtx(uctext.data(), uctext.size(), ucr);
+    EXPECT_EQ(getEdges(ucg), getEdges(ucr));
+
+    UGraph<int> neg;
+    neg.addEdge(-1, 2);
+    std::stringstream nstr;
+    EXPECT_THROW(writeMtx(nstr, neg), std::invalid_argument);
+}
+
+TEST(MtxIO, parallel)
+{
+    IntDblGraph g;
+    unsigned x = 1;
+    for(int i = 0; i < 150000; ++i)
+    {
+        x = x * 1103515245u + 12345u;
+        int s = static_cast<int>((x >> 8) % 30000);
+        x = x * 1103515245u + 12345u;
+        int d = static_cast<int>((x >> 8) % 30000);
+        g.addLblEdge(s, d, (x >> 8) / 7.0);
+    }
+
+    const char* fn = "mtx_io_test.mtx";
+    writeLblMtx(fn, g);
+    MappedFile file(fn);
+    ASSERT_GT(file.getSize(), 2u << 20);        // at least two parts
+
+    for(unsigned threads : {1u, 3u, 8u})
+    {
+        IntDblGraph r;
+        readLblMtx(fn, r, threads);
+        EXPECT_EQ(getVertices(g), getVertices(r));
+        EXPECT_EQ(getEdges(g), getEdges(r));
+    }
+
+    UGraph<int> ug;
+    readMtx(fn, ug, 2);
+    EXPECT_EQ(g.getEdgesNum(), ug.getEdgesNum());
+    std::remove(fn);
+}
+
+TEST(MtxIO, errors)
+{
+    const char* bad[] = {
+        "",
+        "1 2\n",
+        "%%MatrixMarket matrix coordinate real\n1 1 0\n",
+        "%%MatrixMarket vector coordinate real general\n1 1 0\n",
+        "%%MatrixMarket matrix array real general\n1 1\n1\n",
+        "%%MatrixMarket matrix coordinate complex general\n1 1 1\n1 1 1 0\n",
+        "%%MatrixMarket matrix coordinate real skew-symmetric\n2 2 1\n2 1 1\n",
+        "%%MatrixMarket matrix coordinate real hermitian\n2 2 1\n2 1 1\n",
+        "%%MatrixMarket matrix coordinate real general\n",
+        "%%MatrixMarket matrix coordinate real general\n2 3 0\n",
+        "%%MatrixMarket matrix coordinate real general\n2 2\n",
+        "%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1\n",
+        "%%MatrixMarket matrix coordinate real general\n2 2 1\n0 1 1\n",
+        "%%MatrixMarket matrix coordinate real general\n2 2 1\n-1 1 1\n",
+        "%%MatrixMarket matrix coordinate real general\n2 2 1\n2 1\n",
+        "%%MatrixMarket matrix coordinate real general\n2 2 1\n2 1 x\n",
+        "%%MatrixMarket matrix coordinate pattern general\n2 2 1\n2 1 1\n",
+        "%%MatrixMarket matrix coordinate real general\n2 2 2\n2 1 1\n",
+        "%%MatrixMarket matrix coordinate real general\n2 2 1\n2 1 1\n1 1 1\n",
+        "%%MatrixMarket matrix coordinate real general\n300 300 0\n",
+    };
+    for(const char* text : bad)
+    {
+        EdgeLblUGraph<unsigned char, double> g;
+        EXPECT_THROW(readLblMtx(text, std::strlen(text), g), std::invalid_argument) << text;
+        EXPECT_EQ(0u, g.getVerticesNum()) << text;
+    }
+
+    std::string text =
+        "%%MatrixMarket matrix coordinate real general\n"
+        "3 3 3\n"
+        "1 2 1\n"
+        "1 2 1 1\n"
+        "1 3 1\n";
+    IntDblGraph g;
+    try
+    {
+        readLblMtx(text.data(), text.size(), g);
+        FAIL();
+    }
+    catch(const std::invalid_argument& e)
+    {
+        EXPECT_NE(std::string::npos, std::string(e.what()).find("line 4"));
+    }
+
+    EXPECT_THROW(readMtx("no_such_file.mtx", g), std::invalid_argument);
+    EXPECT_THROW(writeMtx("no_such_dir/a.mtx", g), std::invalid_argument);
+}
@@ -14,11 +14,16 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+
 #include "ugraph/ugraph_algos.hpp"
 #include "grviz/ugraph_dotwriter.hpp"
 
-// TODO: set the GV_OUT_DIR macros to the path in your local environment!
+// The GV_OUT_DIR macros is set to the build directory by CMake; set it to the
+// path in your local environment otherwise.
+#ifndef GV_OUT_DIR
 #define GV_OUT_DIR "f:/temp/2020/20200922/gv/"
+#endif
 
 
 TEST(UgraphAlgos, simplest)
@@ -86,3 +91,90 @@ TEST(UgraphAlgos, mstKruskal1)
     // TODO:
 }
 
+
+// Tests independence and maximality of Luby's MIS on a random graph.
+TEST(UgraphAlgos, maximalIndependentSet)
+{
+    const int n = 2000;
+    IntIntGraph g;
+    std::mt19937 rnd(4);
+    std::uniform_int_distribution<int> pick(0, n - 1);
+    for(int i = 0; i < n * 4; ++i)
+        g.addEdge(pick(rnd), pick(rnd));
+
+    CsrUGraph<int> csr(g);
+    auto mis = findMaximalIndependentSet(csr, 4, 11);
+    EXPECT_EQ(mis, findMaximalIndependentSet(csr, 1, 11));
+
+    std::vector<char> in(csr.getVerticesNum(), 0);
+    for(auto v : mis)
+        in[v] = 1;
+    for(CsrUGraph<int>::VId v = 0; v < csr.getVerticesNum(); ++v)
+    {
+        bool hasInNeighbour = false;
+        auto adj = csr.getAdjVertices(v);
+        for(auto it = adj.first; it != adj.second; ++it)
+            if(*it != v && in[*it])
+                hasInNeighbour = true;
+
+        if(in[v])
+            EXPECT_FALSE(hasInNeighbour || csr.hasSelfLoop(v));
+        else
+            EXPECT_TRUE(hasInNeighbour || csr.hasSelfLoop(v));
+    }
+}
+
+// Tests validity and maximality of a random maximal matching.
+TEST(UgraphAlgos, maximalMatching)
+{
+    const int n = 2000;
+    IntIntGraph g;
+    std::mt19937 rnd(6);
+    std::uniform_int_distribution<int> pick(0, n - 1);
+    for(int i = 0; i < n * 2; ++i)
+        g.addEdge(pick(rnd), pick(rnd));
+
+    CsrUGraph<int> csr(g);
+    auto m = findMaximalMatching(csr, 4);
+    EXPECT_EQ(m.mates, findMaximalMatching(csr, 1).mates);
+
+    size_t matched = 0;
+    for(CsrUGraph<int>::VId v = 0; v < csr.getVerticesNum(); ++v)
+    {
+        auto u = m.mates[v];
+        if(u != m.noMate())
+        {
+            ++matched;
+            EXPECT_EQ(v, m.mates[u]);
+            EXPECT_TRUE(g.isEdgeExists(csr.getVertex(v), csr.getVertex(u)));
+            continue;
+        }
+
+        // an unmatched vertex has only matched neighbours
+        auto adj = csr.getAdjVertices(v);
+        for(auto it = adj.first; it != adj.second; ++it)
+        {
+            if(*it != v)
+            {
+                EXPECT_NE(m.noMate(), m.mates[*it]);
+            }
+        }
+    }
+    EXPECT_EQ(matched / 2, m.edgesNum);
+}
+
+TEST(UgraphAlgos, greedyWeightedMatching)
+{
+    CharIntGraph g;
+    g.addLblEdge('a', 'b', 1);
+    g.addLblEdge('b', 'c', 3);
+    g.addLblEdge('c', 'd', 1);
+    g.addLblEdge('d', 'e', 2);
+
+    CsrEdgeLblUGraph<char, int> csr(g);
+    auto m = findGreedyWeightedMatching(csr, 2);
+    EXPECT_EQ(2, m.edgesNum);
+    EXPECT_EQ(2, m.mates[1]);           // b - c
+    EXPECT_EQ(4, m.mates[3]);           // d - e
+    EXPECT_EQ(m.noMate(), m.mates[0]);
+}
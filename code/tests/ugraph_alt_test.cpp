@@ -0,0 +1,162 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for ALT shortest path queries.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+
+#include "ugraph/ugraph_alt.hpp"
+
+
+typedef EdgeLblUGraph<int, int> IntIntGraph;
+typedef CsrEdgeLblUGraph<int, int> IntIntCsrGraph;
+typedef LandmarkTables<int> IntTables;
+
+
+// A random grid with a separate small component.
+static IntIntGraph makeGridGraph(int side, unsigned seed)
+{
+    IntIntGraph g;
+    std::mt19937 rnd(seed);
+    std::uniform_int_distribution<int> len(0, 20);
+    for(int r = 0; r < side; ++r)
+        for(int c = 0; c < side; ++c)
+        {
+            int v = r * side + c;
+            if(c + 1 < side)
+                g.addLblEdge(v, v + 1, len(rnd));
+            if(r + 1 < side)
+                g.addLblEdge(v, v + side, len(rnd));
+        }
+    g.addLblEdge(side * side, side * side + 1, 3);
+
+    return g;
+}
+
+TEST(UGraphAlt, lowerBounds)
+{
+    IntIntCsrGraph csr(makeGridGraph(10, 1));
+    const IntIntCsrGraph::VId n = static_cast<IntIntCsrGraph::VId>(csr.getVerticesNum());
+    for(LandmarkSelection sel : {LandmarkSelection::random, LandmarkSelection::farthest,
+                                 LandmarkSelection::avoid})
+    {
+        IntTables lt(csr, 4, sel, 3);
+        ASSERT_EQ(4u, lt.getLandmarksNum());
+        std::vector<IntTables::VId> lms = lt.getLandmarks();
+        std::sort(lms.begin(), lms.end());
+        EXPECT_TRUE(std::unique(lms.begin(), lms.end()) == lms.end());
+
+        for(IntIntCsrGraph::VId s = 0; s < n; s += 9)
+        {
+            ShortestPaths<IntIntCsrGraph::VId, int> sp = findShortestPathsDijkstra(csr, s);
+            for(IntIntCsrGraph::VId t = 0; t < n; ++t)
+            {
+                if(sp.dists[t] != sp.infinity())
+                {
+                    EXPECT_LE(lt.getLowerBound(s, t), sp.dists[t]);
+                }
+            }
+        }
+    }
+
+    // farthest selection reaches the small component at once
+    IntTables lt(csr, 2, LandmarkSelection::farthest);
+    EXPECT_EQ(IntTables::infinity(), lt.getLowerBound(0, n - 1));
+}
+
+TEST(UGraphAlt, queries)
+{
+    IntIntCsrGraph csr(makeGridGraph(30, 2));
+    const IntIntCsrGraph::VId n = static_cast<IntIntCsrGraph::VId>(csr.getVerticesNum());
+    IntTables lt(csr, 8, LandmarkSelection::avoid, 4);
+    AltQuery<IntIntCsrGraph> q(csr, lt);
+
+    size_t settled = 0, queries = 0;
+    std::vector<IntIntCsrGraph::VId> path;
+    for(IntIntCsrGraph::VId s : {0u, 123u, 455u, 899u})
+    {
+        ShortestPaths<IntIntCsrGraph::VId, int> sp = findShortestPathsDijkstra(csr, s);
+        for(IntIntCsrGraph::VId t = 0; t < n; t += 3)
+        {
+            ASSERT_EQ(sp.dists[t], q.getPath(s, t, path));
+            settled += q.getSettledNum();
+            ++queries;
+            if(sp.dists[t] == sp.infinity())
+            {
+                EXPECT_TRUE(path.empty());
+                continue;
+            }
+
+            ASSERT_FALSE(path.empty());
+            EXPECT_EQ(s, path.front());
+            EXPECT_EQ(t, path.back());
+        }
+    }
+
+    // goal direction settles far less than the whole component on average
+    EXPECT_LT(settled / queries, 900u / 3);
+
+    IntTables wrong(IntIntCsrGraph(makeGridGraph(3, 1)), 1);
+    EXPECT_THROW(AltQuery<IntIntCsrGraph>(csr, wrong), std::invalid_argument);
+}
+
+TEST(UGraphAlt, saveMap)
+{
+    IntIntCsrGraph csr(makeGridGraph(12, 3));
+    IntTables lt(csr, 5, LandmarkSelection::random, 4);
+    const char* fn = "ugraph_alt_test.bin";
+    lt.save(fn);
+
+    IntTables mapped;
+    mapped.map(fn);
+    EXPECT_TRUE(mapped.isMapped());
+    EXPECT_EQ(lt.getLandmarks(), mapped.getLandmarks());
+    IntTables copy = mapped;
+    for(size_t i = 0; i < lt.getLandmarksNum(); ++i)
+        for(IntTables::VId v = 0; v < csr.getVerticesNum(); ++v)
+            ASSERT_EQ(lt.getDistance(i, v), copy.getDistance(i, v));
+
+    AltQuery<IntIntCsrGraph> q(csr, copy);
+    EXPECT_EQ(findShortestPathsDijkstra(csr, 5).dists[140], q.getDistance(5, 140));
+
+    LandmarkTables<double> other;
+    EXPECT_THROW(other.map(fn), std::invalid_argument);
+
+    // a landmark out of range, counts whose product overflows
+    std::string data;
+    {
+        std::ifstream in(fn, std::ios::binary);
+        data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    auto mapBroken = [&](size_t pos, std::uint64_t value, size_t size)
+    {
+        std::string bad = data;
+        std::memcpy(&bad[pos], &value, size);
+        {
+            std::ofstream out(fn, std::ios::binary);
+            out.write(bad.data(), static_cast<std::streamsize>(bad.size()));
+        }
+        EXPECT_THROW(mapped.map(fn), std::invalid_argument) << pos;
+    };
+    mapBroken(32, csr.getVerticesNum(), 4);
+    mapBroken(16, std::uint64_t(1) << 61, 8);
+    mapBroken(24, (std::uint64_t(1) << 62) + csr.getVerticesNum(), 8);     // 5 * 4 bytes
+    mapBroken(24, csr.getVerticesNum() + 1, 8);
+    std::remove(fn);
+    EXPECT_EQ(lt.getLandmarks(), mapped.getLandmarks());
+}
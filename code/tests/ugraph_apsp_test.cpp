@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for all-pairs shortest paths.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "ugraph/ugraph_apsp.hpp"
+#include "ugraph/ugraph_paths.hpp"
+
+
+// A dense random graph of n vertices and two isolated ones; labels are
+// positive for paths to be restored.
+template <typename Label>
+static EdgeLblUGraph<int, Label> makeDenseGraph(int n, unsigned seed)
+{
+    EdgeLblUGraph<int, Label> g;
+    std::mt19937 rnd(seed);
+    for(int u = 0; u < n; ++u)
+        for(int v = u; v < n; ++v)
+            if(rnd() % 4 == 0)
+                g.addLblEdge(u, v, static_cast<Label>(rnd() % 1000 + 4) / 4);
+    g.addVertex(n);
+    g.addVertex(n + 1);
+
+    return g;
+}
+
+// Compares all the distances and paths with Dijkstra's algorithm.
+template <typename Label>
+static void checkAgainstDijkstra(const CsrEdgeLblUGraph<int, Label>& csr,
+                                 const DistanceMatrix<Label>& m)
+{
+    typedef typename CsrEdgeLblUGraph<int, Label>::VId VId;
+    std::vector<VId> path;
+    for(VId s = 0; s < csr.getVerticesNum(); ++s)
+    {
+        ShortestPaths<VId, Label> sp = findShortestPathsDijkstra(csr, s);
+        for(VId t = 0; t < csr.getVerticesNum(); ++t)
+        {
+            ASSERT_EQ(sp.dists[t], m.at(s, t));
+            if(sp.dists[t] == sp.infinity())
+            {
+                EXPECT_FALSE(m.getPath(s, t, path));
+                continue;
+            }
+
+            ASSERT_TRUE(m.getPath(s, t, path));
+            ASSERT_EQ(t, path.back());
+            Label len = Label();
+            for(size_t i = 1; i < path.size(); ++i)
+            {
+                auto adj = csr.getAdjVertices(path[i - 1]);
+                auto it = std::lower_bound(adj.first, adj.second, path[i]);
+                ASSERT_TRUE(it != adj.second && *it == path[i]);
+                len += csr.getAdjLabels(path[i - 1])[it - adj.first];
+            }
+            EXPECT_EQ(sp.dists[t], len);
+        }
+    }
+}
+
+TEST(UGraphApsp, intLabels)
+{
+    CsrEdgeLblUGraph<int, int> csr(makeDenseGraph<int>(150, 1));
+    DistanceMatrix<int> m = findAllPairsShortestPaths(csr, 4, 32);
+    EXPECT_EQ(152u, m.verticesNum);
+    EXPECT_EQ(160u, m.stride);
+    checkAgainstDijkstra(csr, m);
+
+    DistanceMatrix<int> m1 = findAllPairsShortestPaths(csr, 1, 13);
+    for(size_t u = 0; u < m.verticesNum; ++u)
+        for(size_t v = 0; v < m.verticesNum; ++v)
+            ASSERT_EQ(m.at(u, v), m1.at(u, v));
+}
+
+// Quarters are exact in floating point, so sums do not depend on the order.
+TEST(UGraphApsp, floatLabels)
+{
+    CsrEdgeLblUGraph<int, float> csrF(makeDenseGraph<float>(70, 2));
+    checkAgainstDijkstra(csrF, findAllPairsShortestPaths(csrF, 3, 16));
+
+    CsrEdgeLblUGraph<int, double> csrD(makeDenseGraph<double>(40, 3));
+    checkAgainstDijkstra(csrD, findAllPairsShortestPaths(csrD, 2));
+
+    EdgeLblUGraph<int, int> g0;
+    g0.addLblEdge(1, 2, 0);
+    g0.addLblEdge(2, 3, 5);
+    DistanceMatrix<int> m0 = findAllPairsShortestPaths(CsrEdgeLblUGraph<int, int>(g0));
+    EXPECT_EQ(5, m0.at(0, 2));
+    EXPECT_EQ(0, m0.at(1, 0));
+
+    EdgeLblUGraph<int, int> g;
+    g.addLblEdge(1, 2, -1);
+    EXPECT_THROW(findAllPairsShortestPaths(CsrEdgeLblUGraph<int, int>(g)),
+                 std::invalid_argument);
+}
@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for breadth-first search algorithms.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "ugraph/ugraph_bfs.hpp"
+
+
+typedef UGraph<int> IntGraph;
+typedef CsrUGraph<int> IntCsrGraph;
+
+
+TEST(UGraphBfs, singleSource)
+{
+    IntGraph g;
+    g.addEdge(0, 1);
+    g.addEdge(1, 2);
+    g.addEdge(2, 3);
+    g.addEdge(0, 3);
+    g.addEdge(3, 3);
+    g.addVertex(4);
+
+    IntCsrGraph csr(g);
+    std::vector<std::uint32_t> ds = findBfsDistances(csr, 0);
+    std::vector<std::uint32_t> expected = {0, 1, 2, 1, BFS_UNREACHABLE};
+    EXPECT_EQ(expected, ds);
+}
+
+// Compares both batch widths of MS-BFS with single-source BFS runs.
+TEST(UGraphBfs, multiSource)
+{
+    const int n = 1500;
+    IntGraph g;
+    std::mt19937 rnd(11);
+    std::uniform_int_distribution<int> pick(0, n - 1);
+    for(int i = 0; i < n; ++i)
+        g.addVertex(i);
+    for(int i = 0; i < n; ++i)
+        g.addEdge(pick(rnd), pick(rnd));    // sparse: many levels, some islands
+    for(int i = 0; i < n / 2; ++i)
+        g.addEdge(i, i + 1);                // a long chain
+
+    IntCsrGraph csr(g);
+    std::vector<IntCsrGraph::VId> sources;
+    for(int i = 0; i < 300; ++i)
+        sources.push_back(pick(rnd));
+
+    HopDistanceMatrix m64 = findMultiSourceBfsDistances<1>(csr, sources, 3);
+    HopDistanceMatrix m256 = findMultiSourceBfsDistances<4>(csr, sources, 3);
+    ASSERT_EQ(sources.size(), m64.sourcesNum);
+    ASSERT_EQ(n, m64.verticesNum);
+
+    for(size_t i = 0; i < sources.size(); ++i)
+    {
+        std::vector<std::uint32_t> ds = findBfsDistances(csr, sources[i]);
+        for(int v = 0; v < n; ++v)
+        {
+            ASSERT_EQ(ds[v], m64.at(i, v));
+            ASSERT_EQ(ds[v], m256.at(i, v));
+        }
+    }
+}
@@ -0,0 +1,78 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for bridges and articulation points search.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include "ugraph/ugraph_biconnected.hpp"
+
+
+typedef UGraph<int> IntGraph;
+typedef CsrUGraph<int> IntCsrGraph;
+typedef IntGraph::Edge Edge;
+
+
+// Triangle 1-2-3, bridge 3-4, square 4-5-6-7 with a self-loop on 5, bridge 7-8.
+TEST(UGraphBiconnected, simple)
+{
+    IntGraph g;
+    g.addEdge(1, 2);
+    g.addEdge(2, 3);
+    g.addEdge(3, 1);
+    g.addEdge(3, 4);
+    g.addEdge(4, 5);
+    g.addEdge(5, 5);
+    g.addEdge(5, 6);
+    g.addEdge(6, 7);
+    g.addEdge(7, 4);
+    g.addEdge(7, 8);
+    g.addVertex(9);
+
+    IntCsrGraph csr(g);
+    auto bc = findBiconnectivity(csr);
+
+    std::set<Edge> bridges;
+    for(auto e : bc.bridges)
+        bridges.insert(IntGraph::makeNormalizedEdge(csr.getVertex(e.first),
+                                                    csr.getVertex(e.second)));
+    std::set<Edge> expectedBridges = {{3, 4}, {7, 8}};
+    EXPECT_EQ(expectedBridges, bridges);
+
+    std::vector<int> aps;
+    for(auto v : bc.articulationPoints)
+        aps.push_back(csr.getVertex(v));
+    std::vector<int> expectedAps = {3, 4, 7};
+    EXPECT_EQ(expectedAps, aps);
+
+    std::multiset<size_t> sizes;
+    for(auto& comp : bc.components)
+        sizes.insert(comp.size());
+    std::multiset<size_t> expectedSizes = {3, 1, 4, 1};
+    EXPECT_EQ(expectedSizes, sizes);
+}
+
+// A long path would overflow the call stack with a recursive DFS.
+TEST(UGraphBiconnected, longChain)
+{
+    const int n = 100000;
+    IntGraph g;
+    for(int i = 0; i < n; ++i)
+        g.addEdge(i, i + 1);
+    g.addEdge(n, n - 2);                // closes a triangle at the end
+
+    IntCsrGraph csr(g);
+    auto bc = findBiconnectivity(csr);
+    EXPECT_EQ(n - 2, bc.bridges.size());
+    EXPECT_EQ(n - 2, bc.articulationPoints.size());
+    EXPECT_EQ(n - 1, bc.components.size());
+}
@@ -0,0 +1,95 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for betweenness centrality.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "ugraph/ugraph_centrality.hpp"
+
+
+typedef UGraph<int> IntGraph;
+typedef CsrUGraph<int> IntCsrGraph;
+typedef EdgeLblUGraph<int, int> IntIntGraph;
+typedef CsrEdgeLblUGraph<int, int> IntIntCsrGraph;
+
+
+// A path 0-1-2-3-4 with a self-loop and a separate edge 5-6.
+TEST(UGraphCentrality, path)
+{
+    IntGraph g;
+    for(int i = 0; i < 4; ++i)
+        g.addEdge(i, i + 1);
+    g.addEdge(2, 2);
+    g.addEdge(5, 6);
+
+    IntCsrGraph csr(g);
+    std::vector<double> bc = findBetweennessCentrality(csr, 2);
+    std::vector<double> expected = {0, 3, 4, 3, 0, 0, 0};
+    EXPECT_EQ(expected, bc);
+}
+
+// Two shortest paths 0-1-3 and 0-2-3 share the load; the weighted version
+// makes 0-2-3 the only one.
+TEST(UGraphCentrality, square)
+{
+    IntIntGraph g;
+    g.addLblEdge(0, 1, 1);
+    g.addLblEdge(1, 3, 2);
+    g.addLblEdge(0, 2, 1);
+    g.addLblEdge(2, 3, 1);
+
+    IntIntCsrGraph csr(g);
+    std::vector<double> bc = findBetweennessCentrality(csr);
+    EXPECT_DOUBLE_EQ(0.5, bc[0]);
+    EXPECT_DOUBLE_EQ(0.5, bc[1]);
+
+    std::vector<double> wbc = findWeightedBetweennessCentrality(csr, 2);
+    std::vector<double> expected = {1, 0, 1, 0};
+    EXPECT_EQ(expected, wbc);
+
+    IntIntGraph g1;
+    g1.addLblEdge(0, 1, 0);
+    EXPECT_THROW(findWeightedBetweennessCentrality(IntIntCsrGraph(g1)),
+                 std::invalid_argument);
+}
+
+// Unit labels give the same result as BFS; sampling all the sources too.
+TEST(UGraphCentrality, randomGraph)
+{
+    const int n = 300;
+    IntIntGraph g;
+    std::mt19937 rnd(5);
+    std::uniform_int_distribution<int> pick(0, n - 1);
+    for(int i = 0; i < n * 3; ++i)
+        g.addLblEdge(pick(rnd), pick(rnd), 1);
+
+    IntIntCsrGraph csr(g);
+    std::vector<double> bc1 = findBetweennessCentrality(csr, 1);
+    std::vector<double> bc4 = findBetweennessCentrality(csr, 4);
+    std::vector<double> wbc = findWeightedBetweennessCentrality(csr, 3);
+    std::vector<double> all = findBetweennessCentrality(csr, 4, csr.getVerticesNum());
+    std::vector<double> smp = findBetweennessCentrality(csr, 4, 100);
+
+    double sum = 0, smpSum = 0;
+    for(size_t v = 0; v < csr.getVerticesNum(); ++v)
+    {
+        EXPECT_NEAR(bc1[v], bc4[v], 1e-6);
+        EXPECT_NEAR(bc1[v], wbc[v], 1e-6);
+        EXPECT_NEAR(bc1[v], all[v], 1e-6);
+        sum += bc1[v];
+        smpSum += smp[v];
+    }
+    EXPECT_NEAR(1.0, smpSum / sum, 0.2);
+}
@@ -0,0 +1,181 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for contraction hierarchies.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+
+#include "ugraph/ugraph_ch.hpp"
+#include "ugraph/ugraph_paths.hpp"
+
+
+typedef EdgeLblUGraph<int, int> IntIntGraph;
+typedef CsrEdgeLblUGraph<int, int> IntIntCsrGraph;
+typedef ContractionHierarchy<int> IntCh;
+
+
+// A grid-like random graph with a few isolated vertices.
+static IntIntGraph makeRoadLikeGraph(int side, unsigned seed)
+{
+    IntIntGraph g;
+    std::mt19937 rnd(seed);
+    std::uniform_int_distribution<int> len(1, 20);
+    for(int r = 0; r < side; ++r)
+        for(int c = 0; c < side; ++c)
+        {
+            int v = r * side + c;
+            if(c + 1 < side && rnd() % 8)
+                g.addLblEdge(v, v + 1, len(rnd));
+            if(r + 1 < side && rnd() % 8)
+                g.addLblEdge(v, v + side, len(rnd));
+            if(rnd() % 16 == 0)
+                g.addLblEdge(v, v, 1);
+        }
+    g.addVertex(side * side);
+
+    return g;
+}
+
+// Checks that the path goes along the graph edges with the given length.
+static void checkPath(const IntIntCsrGraph& g, const std::vector<IntCh::VId>& path,
+                      IntCh::VId s, IntCh::VId t, int dist)
+{
+    ASSERT_FALSE(path.empty());
+    EXPECT_EQ(s, path.front());
+    EXPECT_EQ(t, path.back());
+
+    int len = 0;
+    for(size_t i = 1; i < path.size(); ++i)
+    {
+        IntIntCsrGraph::AdjIterPair adj = g.getAdjVertices(path[i - 1]);
+        auto it = std::lower_bound(adj.first, adj.second, path[i]);
+        ASSERT_TRUE(it != adj.second && *it == path[i]);
+        len += g.getAdjLabels(path[i - 1])[it - adj.first];
+    }
+    EXPECT_EQ(dist, len);
+}
+
+TEST(UGraphCh, simple)
+{
+    IntIntGraph g;
+    g.addLblEdge(1, 2, 4);
+    g.addLblEdge(2, 3, 1);
+    g.addLblEdge(1, 3, 7);
+    g.addLblEdge(3, 4, 2);
+    g.addLblEdge(5, 6, 3);
+
+    IntIntCsrGraph csr(g);
+    IntCh ch(csr);
+    ChQuery<int> q(ch);
+    EXPECT_EQ(7, q.getDistance(0, 3));
+    EXPECT_EQ(0, q.getDistance(2, 2));
+    EXPECT_EQ(IntCh::infinity(), q.getDistance(0, 5));
+
+    std::vector<IntCh::VId> path;
+    EXPECT_EQ(7, q.getPath(3, 0, path));
+    std::vector<IntCh::VId> expected = {3, 2, 1, 0};
+    EXPECT_EQ(expected, path);
+    EXPECT_EQ(IntCh::infinity(), q.getPath(0, 4, path));
+    EXPECT_TRUE(path.empty());
+
+    IntIntGraph g1;
+    g1.addLblEdge(1, 2, -1);
+    EXPECT_THROW(IntCh(IntIntCsrGraph(g1)), std::invalid_argument);
+}
+
+// All distances from a few sources agree with Dijkstra's algorithm.
+TEST(UGraphCh, randomAgainstDijkstra)
+{
+    IntIntCsrGraph csr(makeRoadLikeGraph(30, 3));
+    IntCh ch(csr);
+    ChQuery<int> q(ch);
+    EXPECT_EQ(csr.getVerticesNum(), ch.getVerticesNum());
+
+    std::vector<IntCh::VId> path;
+    for(IntCh::VId s : {0u, 77u, 450u, 899u})
+    {
+        ShortestPaths<IntCh::VId, int> sp = findShortestPathsDijkstra(csr, s);
+        for(IntCh::VId t = 0; t < csr.getVerticesNum(); ++t)
+        {
+            ASSERT_EQ(sp.dists[t], q.getDistance(s, t));
+            if(t % 37 == 0 && sp.dists[t] != sp.infinity())
+            {
+                q.getPath(s, t, path);
+                checkPath(csr, path, s, t, sp.dists[t]);
+            }
+        }
+    }
+}
+
+TEST(UGraphCh, saveLoad)
+{
+    IntIntCsrGraph csr(makeRoadLikeGraph(15, 4));
+    IntCh ch(csr, 50);
+    const char* fn = "ugraph_ch_test.bin";
+    ch.save(fn);
+
+    IntCh loaded;
+    loaded.load(fn);
+    std::remove(fn);
+    EXPECT_EQ(ch.getEdgesNum(), loaded.getEdgesNum());
+
+    ChQuery<int> q1(ch), q2(loaded);
+    for(IntCh::VId s = 0; s < csr.getVerticesNum(); s += 7)
+        for(IntCh::VId t = 0; t < csr.getVerticesNum(); t += 5)
+            ASSERT_EQ(q1.getDistance(s, t), q2.getDistance(s, t));
+
+    EXPECT_THROW(loaded.load("no/such/file.bin"), std::invalid_argument);
+    ContractionHierarchy<double> other;
+    ch.save(fn);
+    EXPECT_THROW(other.load(fn), std::invalid_argument);
+
+    // corrupt files are rejected, leaving the loaded index intact
+    std::string data;
+    {
+        std::ifstream in(fn, std::ios::binary);
+        data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    const size_t n = csr.getVerticesNum(), sizesPos = 12, ranksPos = 28;
+    const size_t offsetsPos = ranksPos + n * 4, adjPos = offsetsPos + (n + 1) * 8;
+    auto loadBroken = [&](size_t pos, std::uint64_t value, size_t size)
+    {
+        std::string bad = data;
+        std::memcpy(&bad[pos], &value, size);
+        {
+            std::ofstream out(fn, std::ios::binary);
+            out.write(bad.data(), static_cast<std::streamsize>(bad.size()));
+        }
+        EXPECT_THROW(loaded.load(fn), std::invalid_argument) << pos;
+    };
+    loadBroken(sizesPos, std::uint64_t(1) << 60, 8);        // a huge vertex number
+    loadBroken(sizesPos + 8, std::uint64_t(-1) / 2, 8);     // a huge edge number
+    loadBroken(sizesPos + 8, ch.getEdgesNum() + 1, 8);      // past the end
+    loadBroken(offsetsPos, 1, 8);
+    loadBroken(offsetsPos + 8 * 3, std::uint64_t(1) << 40, 8);
+    loadBroken(adjPos, n, 4);
+    {
+        std::ofstream out(fn, std::ios::binary);
+        out.write(data.data(), static_cast<std::streamsize>(data.size() - 1));
+    }
+    EXPECT_THROW(loaded.load(fn), std::invalid_argument);
+    std::remove(fn);
+
+    ChQuery<int> q3(loaded);
+    for(IntCh::VId s = 0; s < csr.getVerticesNum(); s += 11)
+        ASSERT_EQ(q1.getDistance(s, 3), q3.getDistance(s, 3));
+}
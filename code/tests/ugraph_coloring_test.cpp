@@ -0,0 +1,94 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for graph coloring.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "ugraph/ugraph_coloring.hpp"
+
+
+typedef UGraph<int> IntGraph;
+typedef CsrUGraph<int> IntCsrGraph;
+
+
+// Checks that no edge (except self-loops) connects two vertices of one color.
+static bool isProperColoring(const IntCsrGraph& g, const GraphColoring& gc)
+{
+    for(IntCsrGraph::VId v = 0; v < g.getVerticesNum(); ++v)
+    {
+        if(gc.colors[v] >= gc.colorsNum)
+            return false;
+
+        IntCsrGraph::AdjIterPair adj = g.getAdjVertices(v);
+        for(auto it = adj.first; it != adj.second; ++it)
+            if(*it != v && gc.colors[*it] == gc.colors[v])
+                return false;
+    }
+
+    return true;
+}
+
+TEST(UGraphColoring, complete)
+{
+    IntGraph g;
+    for(int i = 0; i < 5; ++i)
+        for(int j = i; j < 5; ++j)
+            g.addEdge(i, j);                // with self-loops
+
+    IntCsrGraph csr(g);
+    for(ColoringOrder o : {ColoringOrder::random, ColoringOrder::largestFirst,
+                           ColoringOrder::smallestLast})
+    {
+        GraphColoring gc = colorGraphJonesPlassmann(csr, o, 2);
+        EXPECT_TRUE(isProperColoring(csr, gc));
+        EXPECT_EQ(5, gc.colorsNum);
+        EXPECT_EQ(5, gc.roundTimes.size());
+    }
+}
+
+// Smallest-last needs 2 colors for any tree.
+TEST(UGraphColoring, treeSmallestLast)
+{
+    IntGraph g;
+    std::mt19937 rnd(1);
+    for(int i = 1; i < 1000; ++i)
+        g.addEdge(i, static_cast<int>(rnd() % i));
+
+    IntCsrGraph csr(g);
+    GraphColoring gc = colorGraphJonesPlassmann(csr, ColoringOrder::smallestLast, 3);
+    EXPECT_TRUE(isProperColoring(csr, gc));
+    EXPECT_EQ(2, gc.colorsNum);
+}
+
+TEST(UGraphColoring, randomDeterministic)
+{
+    const int n = 3000;
+    IntGraph g;
+    std::mt19937 rnd(2);
+    std::uniform_int_distribution<int> pick(0, n - 1);
+    for(int i = 0; i < n * 8; ++i)
+        g.addEdge(pick(rnd), pick(rnd));
+
+    IntCsrGraph csr(g);
+    size_t maxDeg = csr.getDegreeStats().maxDegree;
+    for(ColoringOrder o : {ColoringOrder::random, ColoringOrder::largestFirst})
+    {
+        GraphColoring gc1 = colorGraphJonesPlassmann(csr, o, 1, 7);
+        GraphColoring gc4 = colorGraphJonesPlassmann(csr, o, 4, 7);
+        EXPECT_TRUE(isProperColoring(csr, gc4));
+        EXPECT_LE(gc4.colorsNum, maxDeg + 1);
+        EXPECT_EQ(gc1.colors, gc4.colors);
+    }
+}
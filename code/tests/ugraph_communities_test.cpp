@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for community detection.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include "ugraph/ugraph_communities.hpp"
+
+
+typedef EdgeLblUGraph<int, int> IntIntGraph;
+typedef CsrEdgeLblUGraph<int, int> IntIntCsrGraph;
+
+
+// A ring of cliqueNum cliques of cliqueSize vertices joined by single edges.
+static IntIntGraph makeRingOfCliques(int cliqueNum, int cliqueSize)
+{
+    IntIntGraph g;
+    for(int c = 0; c < cliqueNum; ++c)
+    {
+        int base = c * cliqueSize;
+        for(int i = 0; i < cliqueSize; ++i)
+            for(int j = i + 1; j < cliqueSize; ++j)
+                g.addLblEdge(base + i, base + j, 1);
+        g.addLblEdge(base, (base + cliqueSize) % (cliqueNum * cliqueSize), 1);
+    }
+
+    return g;
+}
+
+// Checks that no clique is split between communities.
+static void checkCliques(const Communities& cs, int cliqueNum, int cliqueSize)
+{
+    EXPECT_LE(cs.commsNum, static_cast<std::uint32_t>(cliqueNum));
+    for(int v = 0; v < cliqueNum * cliqueSize; ++v)
+        EXPECT_EQ(cs.commIds[v - v % cliqueSize], cs.commIds[v]);
+}
+
+TEST(UGraphCommunities, modularity)
+{
+    IntIntCsrGraph csr(makeRingOfCliques(2, 3));
+
+    std::vector<std::uint32_t> one(6, 0);
+    EXPECT_DOUBLE_EQ(0.0, getModularity(csr, one));
+
+    // 2 communities with 3 inner edges and a degree sum of 7 each
+    std::vector<std::uint32_t> two = {0, 0, 0, 1, 1, 1};
+    EXPECT_DOUBLE_EQ(2 * (6.0 / 14 - 0.25), getModularity(csr, two));
+}
+
+TEST(UGraphCommunities, labelPropagation)
+{
+    IntIntCsrGraph csr(makeRingOfCliques(10, 8));
+    Communities cs = findCommunitiesLabelPropagation(csr, 1);
+    checkCliques(cs, 10, 8);
+    EXPECT_GT(cs.commsNum, 1u);
+    EXPECT_DOUBLE_EQ(getModularity(csr, cs.commIds), cs.modularity);
+
+    Communities cs4 = findCommunitiesLabelPropagation(csr, 4);
+    checkCliques(cs4, 10, 8);
+}
+
+TEST(UGraphCommunities, louvain)
+{
+    IntIntCsrGraph csr(makeRingOfCliques(16, 5));
+    Communities cs = findCommunitiesLouvain(csr, 4);
+    EXPECT_FALSE(cs.levels.empty());
+    EXPECT_EQ(cs.commIds, cs.levels.back());
+    EXPECT_DOUBLE_EQ(getModularity(csr, cs.commIds), cs.modularity);
+    EXPECT_GT(cs.modularity, 0.8);
+
+    checkCliques(cs, 16, 5);
+
+    IntIntGraph g;
+    g.addLblEdge(1, 2, -1);
+    EXPECT_THROW(findCommunitiesLouvain(IntIntCsrGraph(g)), std::invalid_argument);
+}
+
+// Heavy edges keep their ends together despite the topology.
+TEST(UGraphCommunities, weightsAndCoarseGraph)
+{
+    IntIntGraph g;
+    g.addLblEdge(0, 1, 100);
+    g.addLblEdge(2, 3, 100);
+    g.addLblEdge(0, 2, 1);
+    g.addLblEdge(1, 3, 1);
+    g.addLblEdge(0, 0, 5);
+
+    IntIntCsrGraph csr(g);
+    Communities cs = findCommunitiesLouvain(csr);
+    EXPECT_EQ(2u, cs.commsNum);
+    EXPECT_EQ(cs.commIds[0], cs.commIds[1]);
+    EXPECT_EQ(cs.commIds[2], cs.commIds[3]);
+
+    EdgeLblUGraph<std::uint32_t, int> cg = makeCommunityGraph(csr, cs.commIds);
+    EXPECT_EQ(2, cg.getVerticesNum());
+    EXPECT_EQ(3, cg.getEdgesNum());
+    std::uint32_t a = cs.commIds[0], b = cs.commIds[2];
+    int lbl = 0;
+    EXPECT_TRUE(cg.getLabel(a, b, lbl));
+    EXPECT_EQ(2, lbl);
+    EXPECT_TRUE(cg.getLabel(a, a, lbl));
+    EXPECT_EQ(105, lbl);
+    EXPECT_TRUE(cg.getLabel(b, b, lbl));
+    EXPECT_EQ(100, lbl);
+}
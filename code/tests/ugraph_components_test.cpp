@@ -0,0 +1,130 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for connected components algorithms.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "ugraph/ugraph_components.hpp"
+
+
+typedef UGraph<int> IntGraph;
+typedef CsrUGraph<int> IntCsrGraph;
+
+
+TEST(CsrUGraph, simpleCreation)
+{
+    IntGraph g;
+    g.addEdge(1, 2);
+    g.addEdge(1, 3);
+    g.addEdge(3, 3);
+    g.addVertex(7);
+
+    IntCsrGraph csr(g);
+    EXPECT_EQ(4, csr.getVerticesNum());
+    EXPECT_EQ(3, csr.getEdgesNum());
+
+    IntCsrGraph::VId v;
+    EXPECT_TRUE(csr.getVId(3, v));
+    EXPECT_EQ(2, v);
+    EXPECT_EQ(3, csr.getVertex(v));
+    EXPECT_EQ(2, csr.getDegree(v));     // {1, 3} and a self-loop once
+    EXPECT_FALSE(csr.getVId(5, v));
+
+    ASSERT_TRUE(csr.getVId(1, v));
+    IntCsrGraph::AdjIterPair adj = csr.getAdjVertices(v);
+    ASSERT_EQ(2, adj.second - adj.first);
+    EXPECT_EQ(1, adj.first[0]);         // vertex 2
+    EXPECT_EQ(2, adj.first[1]);         // vertex 3
+}
+
+TEST(UGraphComponents, afforest1)
+{
+    IntGraph g;
+    g.addEdge(1, 2);
+    g.addEdge(2, 3);
+    g.addEdge(4, 5);
+    g.addEdge(6, 6);
+    g.addVertex(7);
+
+    IntCsrGraph csr(g);
+    auto cc = findComponentsAfforest(csr, 2);
+    ASSERT_EQ(4, cc.getComponentsNum());
+    EXPECT_EQ(3, cc.compSizes[0]);
+    EXPECT_EQ(2, cc.compSizes[1]);
+    EXPECT_EQ(1, cc.compSizes[2]);
+    EXPECT_EQ(1, cc.compSizes[3]);
+
+    // vertices 1..7 have dense ids 0..6
+    EXPECT_EQ(0, cc.compIds[0]);
+    EXPECT_EQ(0, cc.compIds[2]);
+    EXPECT_EQ(1, cc.compIds[3]);
+    EXPECT_EQ(1, cc.compIds[4]);
+    EXPECT_EQ(2, cc.compIds[5]);
+    EXPECT_EQ(3, cc.compIds[6]);
+}
+
+// Compares Afforest with a plain sequential union-find on a random graph.
+TEST(UGraphComponents, afforestRandom)
+{
+    const int n = 3000;
+    IntGraph g;
+    std::mt19937 rnd(42);
+    std::uniform_int_distribution<int> pick(0, n - 1);
+    for(int i = 0; i < n; ++i)
+        g.addVertex(i);
+    for(int i = 0; i < n * 9 / 10; ++i)
+        g.addEdge(pick(rnd), pick(rnd));
+
+    std::vector<int> parent(n);
+    for(int i = 0; i < n; ++i)
+        parent[i] = i;
+    auto find = [&](int v) {
+        while(parent[v] != v)
+            v = parent[v] = parent[parent[v]];
+        return v;
+    };
+    IntGraph::EdgeIterPair es = g.getEdges();
+    for(IntGraph::EdgeIter it = es.first; it != es.second; ++it)
+        parent[find(it->first)] = find(it->second);
+
+    IntCsrGraph csr(g);
+    auto cc = findComponentsAfforest(csr, 4, 2, 64);
+    ASSERT_EQ(n, cc.compIds.size());
+
+    size_t total = 0;
+    for(size_t s : cc.compSizes)
+        total += s;
+    EXPECT_EQ(n, total);
+
+    for(int i = 0; i < n; ++i)
+        for(int j : {0, i / 2, n - 1})
+            EXPECT_EQ(find(i) == find(j), cc.compIds[i] == cc.compIds[j]);
+}
+
+TEST(CsrUGraph, getDegreeStats)
+{
+    IntGraph g;
+    g.addEdge(1, 2);
+    g.addEdge(1, 3);
+    g.addEdge(3, 3);
+    g.addVertex(7);
+
+    DegreeStats st = IntCsrGraph(g).getDegreeStats();
+    DegreeStats expected = g.getDegreeStats();
+    EXPECT_EQ(expected.minDegree, st.minDegree);
+    EXPECT_EQ(expected.maxDegree, st.maxDegree);
+    EXPECT_DOUBLE_EQ(expected.meanDegree, st.meanDegree);
+    EXPECT_EQ(expected.histogram, st.histogram);
+}
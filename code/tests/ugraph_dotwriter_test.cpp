@@ -15,10 +15,18 @@
 
 #include <gtest/gtest.h>
 
+#include <climits>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
 #include "ugraph/lbl_ugraph.hpp"
 #include "grviz/ugraph_dotwriter.hpp"
 
+#ifndef GV_OUT_DIR
 #define GV_OUT_DIR "f:/temp/2020/20200922/gv/"
+#endif
 
 TEST(UGraphDotWriter, simplest)
 {
@@ -38,3 +46,256 @@ TEST(UGraphDotWriter, simpleGraph)
     IntIntGraphDW dw;   // dotwriter
     dw.write(GV_OUT_DIR "test1.gv", g, "Test Graph");
 }
+
+static IntIntGraph makeSinkGraph()
+{
+    IntIntGraph g;
+    for(int i = 0; i < 500; ++i)
+        g.addLblEdge(i, (i * 7 + 3) % 500, i * 1000);
+    g.addEdge(1, 1000);
+
+    return g;
+}
+
+static std::string makeSinkRef(const IntIntGraph& g)
+{
+    IntIntGraphDW dw;
+    std::stringstream str;
+    dw.write(str, g, "Test Graph");
+
+    return str.str();
+}
+
+TEST(UGraphDotWriter, streamAndFile)
+{
+    IntIntGraph g = makeSinkGraph();
+    std::string ref = makeSinkRef(g);
+    EXPECT_EQ(0u, ref.find("graph G {\n    label=\"Test Graph\";\n"));
+
+    IntIntGraphDW dw;
+    dw.write(GV_OUT_DIR "test_sink.gv", g, "Test Graph");
+    std::ifstream in(GV_OUT_DIR "test_sink.gv");
+    std::stringstream fromFile;
+    fromFile << in.rdbuf();
+    EXPECT_EQ(ref, fromFile.str());
+}
+
+TEST(UGraphDotWriter, sinkCallback)
+{
+    IntIntGraph g = makeSinkGraph();
+    std::string ref = makeSinkRef(g);
+
+    IntIntGraphDW dw;
+    for(size_t bufSize : {1u, 7u, 4096u, 1u << 20})
+    {
+        std::string res;
+        size_t calls = 0;
+        dw.writeToSink([&](const char* data, size_t n)
+        {
+            res.append(data, n);
+            ++calls;
+        }, g, "Test Graph", bufSize);
+
+        EXPECT_EQ(ref, res);
+        if(bufSize > ref.size())
+        {
+            EXPECT_LE(calls, 3u);       // header, body, tail at most
+        }
+    }
+
+    // errors of the sink reach the caller
+    size_t written = 0;
+    EXPECT_THROW(dw.writeToSink([&](const char*, size_t n)
+    {
+        written += n;
+        if(written > 1000)
+            throw std::runtime_error("sink is full");
+    }, g, "Test Graph", 256), std::runtime_error);
+
+    // the writer is still usable
+    std::string res;
+    dw.writeToSink([&](const char* data, size_t n) { res.append(data, n); }, g, "Test Graph");
+    EXPECT_EQ(ref, res);
+}
+
+#ifdef GRVIZ_HAS_FD
+TEST(UGraphDotWriter, sinkFd)
+{
+    IntIntGraph g = makeSinkGraph();
+    std::string ref = makeSinkRef(g);
+
+    std::FILE* f = std::tmpfile();
+    ASSERT_NE(nullptr, f);
+    IntIntGraphDW dw;
+    dw.writeToFd(fileno(f), g, "Test Graph", 100);
+
+    std::rewind(f);
+    std::string res;
+    char buf[1024];
+    size_t n;
+    while((n = std::fread(buf, 1, sizeof(buf), f)) > 0)
+        res.append(buf, n);
+    std::fclose(f);
+    EXPECT_EQ(ref, res);
+
+    EXPECT_THROW(dw.writeToFd(-1, g, "Test Graph"), std::invalid_argument);
+}
+#endif
+
+
+// The original per-edge stringstream formatting, as a reference.
+template <typename Vertex, typename EdgeLbl>
+static std::string makeReferenceBody(const EdgeLblUGraph<Vertex, EdgeLbl>& g)
+{
+    typedef EdgeLblUGraph<Vertex, EdgeLbl> Graph;
+    typedef xi::ldopa::graph::DefaultDotVisitor<Graph> Visitor;
+
+    std::stringstream str;
+    typename Graph::VertexIterPair vs = g.getVertices();
+    for(typename Graph::VertexIter it = vs.first; it != vs.second; ++it)
+        str << *it << "\n";
+
+    typename Graph::EdgeIterPair es = g.getEdges();
+    for(typename Graph::EdgeIter it = es.first; it != es.second; ++it)
+    {
+        typename Visitor::ParamValueList pars;
+        EdgeLbl lbl;
+        if(g.getLabel(it->first, it->second, lbl))
+        {
+            std::stringstream ss;
+            ss << lbl;
+            pars.append("label", Visitor::makeEscapedString(ss.str()));
+        }
+        str << it->first << " -- " << it->second
+            << " " << Visitor::makeParamValueStr(pars) << "\n";
+    }
+
+    return str.str();
+}
+
+template <typename Vertex, typename EdgeLbl>
+static std::string makeBody(const EdgeLblUGraph<Vertex, EdgeLbl>& g)
+{
+    std::stringstream str;
+    EdgeLblUGraphDotVisitor<Vertex, EdgeLbl> v;
+    v.outputBody(str, g);
+    v.outputBody(str, g);       // the buffer is reused
+
+    return str.str();
+}
+
+TEST(UGraphDotWriter, bufferedBodyIsIdentical)
+{
+    IntIntGraph g1;
+    g1.addLblEdge(1, 2, 10);
+    g1.addLblEdge(-7, 3, INT_MIN);
+    g1.addEdge(1, 4);
+    g1.addLblEdge(4, 4, INT_MAX);
+    g1.addLblEdge(0, 5, 0);
+    std::string ref1 = makeReferenceBody(g1);
+    EXPECT_EQ(ref1 + ref1, makeBody(g1));
+
+    EdgeLblUGraph<char, std::string> g2;
+    g2.addLblEdge('a', 'b', "say \"hi\"");
+    g2.addLblEdge('b', 'c', "back\\slash");
+    g2.addLblEdge('c', 'a', "");
+    g2.addEdge('d', 'a');
+    std::string ref2 = makeReferenceBody(g2);
+    EXPECT_EQ(ref2 + ref2, makeBody(g2));
+
+    EdgeLblUGraph<long long, double> g3;
+    g3.addLblEdge(-5000000000LL, 3, 0.1);
+    g3.addLblEdge(3, 4, -1e300);
+    g3.addLblEdge(4, 5, 12345678.9);
+    std::string ref3 = makeReferenceBody(g3);
+    EXPECT_EQ(ref3 + ref3, makeBody(g3));
+
+    EdgeLblUGraph<unsigned, bool> g4;
+    g4.addLblEdge(0, 4000000000u, true);
+    g4.addLblEdge(1, 2, false);
+    std::string ref4 = makeReferenceBody(g4);
+    EXPECT_EQ(ref4 + ref4, makeBody(g4));
+}
+
+// A tiny buffer is flushed and grown (while escaping) many times.
+TEST(UGraphDotWriter, smallBuffer)
+{
+    std::stringstream str, ref;
+    xi::ldopa::graph::DotOutBuffer buf(4);
+    buf.attach(str);
+    for(int i = -1000; i < 1000; i += 7)
+    {
+        buf.putValue(i);
+        buf.put(" -- a long piece of text\n");
+        buf.putEscapedValue(std::string("\"\\ quoted \"") + std::to_string(i));
+        buf.putValue(0.5 * i);
+        buf.putValue('\n');
+
+        ref << i << " -- a long piece of text\n"
+            << xi::ldopa::graph::DefaultDotVisitor<int>::makeEscapedString(
+                   std::string("\"\\ quoted \"") + std::to_string(i))
+            << 0.5 * i << '\n';
+    }
+    buf.detach();
+    EXPECT_EQ(ref.str(), str.str());
+
+    // not attached: everything is kept
+    buf.put("pending");
+    EXPECT_EQ("pending", buf.getPending());
+}
+
+template <typename Vertex, typename EdgeLbl>
+static std::string makeDump(const EdgeLblUGraph<Vertex, EdgeLbl>& g)
+{
+    std::stringstream str;
+    EdgeLblUGraphDotVisitor<Vertex, EdgeLbl> v;
+    v.outputHeader(str, g, "Test Graph");
+    v.outputBody(str, g);
+    v.outputTail(str, g);
+
+    return str.str();
+}
+
+TEST(UGraphDotWriter, parallel)
+{
+    IntIntGraph g;
+    IntIntGraphDW dw;
+    for(unsigned threads : {1u, 2u, 3u, 8u})
+    {
+        std::stringstream str;
+        dw.writeParallel(str, g, threads, "Test Graph");
+        EXPECT_EQ(makeDump(g), str.str());
+    }
+
+    // isolated vertices, self-loops, hubs and unlabeled edges
+    unsigned x = 1;
+    for(int i = 0; i < 3000; ++i)
+    {
+        x = x * 1103515245u + 12345u;
+        int s = static_cast<int>(x >> 8) % 1000 - 500;
+        x = x * 1103515245u + 12345u;
+        int d = (i % 5 == 0) ? 7 : static_cast<int>(x >> 8) % 1000 - 500;
+        if(i % 97 == 0)
+            d = s;
+        if(i % 3 == 0)
+            g.addEdge(s, d);
+        else
+            g.addLblEdge(s, d, i);
+    }
+    g.addVertex(100000);
+    g.addVertex(-100000);
+
+    std::string ref = makeDump(g);
+    for(unsigned threads : {1u, 2u, 3u, 8u, 0u})
+    {
+        std::stringstream str;
+        dw.writeParallel(str, g, threads, "Test Graph");
+        EXPECT_EQ(ref, str.str());
+    }
+
+    IntIntGraph one;
+    one.addVertex(1);
+    std::stringstream str;
+    dw.writeParallel(str, one, 4, "Test Graph");
+    EXPECT_EQ(makeDump(one), str.str());
+}
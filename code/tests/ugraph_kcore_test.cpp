@@ -0,0 +1,76 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for k-core decomposition.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "ugraph/ugraph_kcore.hpp"
+
+
+typedef UGraph<int> IntGraph;
+typedef CsrUGraph<int> IntCsrGraph;
+
+
+// K4 (3-core) with a tail 3-4-5, a triangle-free square 6..9 and a self-loop.
+TEST(UGraphKCore, simple)
+{
+    IntGraph g;
+    for(int i = 0; i < 4; ++i)
+        for(int j = i + 1; j < 4; ++j)
+            g.addEdge(i, j);
+    g.addEdge(3, 4);
+    g.addEdge(4, 5);
+    g.addEdge(5, 5);
+    g.addEdge(6, 7);
+    g.addEdge(7, 8);
+    g.addEdge(8, 9);
+    g.addEdge(9, 6);
+    g.addVertex(10);
+
+    IntCsrGraph csr(g);
+    std::vector<std::uint32_t> expected = {3, 3, 3, 3, 1, 1, 2, 2, 2, 2, 0};
+
+    KCoreDecomposition seq = findCoreNumbers(csr);
+    EXPECT_EQ(expected, seq.coreNums);
+    EXPECT_EQ(3, seq.maxCore);
+
+    KCoreDecomposition par = findCoreNumbersParallel(csr, 2);
+    EXPECT_EQ(expected, par.coreNums);
+    EXPECT_EQ(3, par.maxCore);
+
+    IntGraph mc = getMaxCoreSubgraph(csr, seq);
+    EXPECT_EQ(4, mc.getVerticesNum());
+    EXPECT_EQ(6, mc.getEdgesNum());
+    EXPECT_FALSE(mc.isVertexExists(4));
+}
+
+TEST(UGraphKCore, randomParallel)
+{
+    const int n = 2000;
+    IntGraph g;
+    std::mt19937 rnd(5);
+    std::uniform_int_distribution<int> pick(0, n - 1);
+    for(int i = 0; i < n * 5; ++i)
+    {
+        int a = pick(rnd);
+        g.addEdge(a, std::min(n - 1, a + pick(rnd) % 40));   // skewed degrees
+    }
+
+    IntCsrGraph csr(g);
+    KCoreDecomposition seq = findCoreNumbers(csr);
+    KCoreDecomposition par = findCoreNumbersParallel(csr, 4);
+    EXPECT_EQ(seq.coreNums, par.coreNums);
+    EXPECT_EQ(seq.maxCore, par.maxCore);
+}
@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for global minimum cut algorithms.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "ugraph/ugraph_mincut.hpp"
+
+
+typedef EdgeLblUGraph<int, int> IntIntGraph;
+typedef CsrEdgeLblUGraph<int, int> IntIntCsrGraph;
+
+
+// Sums capacities of the edges crossing the given cut.
+static int getCutValue(const IntIntCsrGraph& g, const std::vector<bool>& side)
+{
+    int val = 0;
+    for(IntIntCsrGraph::VId v = 0; v < g.getVerticesNum(); ++v)
+        for(size_t i = 0; i < g.getDegree(v); ++i)
+        {
+            IntIntCsrGraph::VId u = g.getAdjVertices(v).first[i];
+            if(v < u && side[v] != side[u])
+                val += g.getAdjLabels(v)[i];
+        }
+
+    return val;
+}
+
+// The graph from the Stoer–Wagner paper, min cut is 4: {3, 4, 7, 8}.
+static IntIntGraph makeStoerWagnerGraph()
+{
+    IntIntGraph g;
+    g.addLblEdge(1, 2, 2);
+    g.addLblEdge(1, 5, 3);
+    g.addLblEdge(2, 3, 3);
+    g.addLblEdge(2, 5, 2);
+    g.addLblEdge(2, 6, 2);
+    g.addLblEdge(3, 4, 4);
+    g.addLblEdge(3, 7, 2);
+    g.addLblEdge(4, 7, 2);
+    g.addLblEdge(4, 8, 2);
+    g.addLblEdge(5, 6, 3);
+    g.addLblEdge(6, 7, 1);
+    g.addLblEdge(7, 8, 3);
+    return g;
+}
+
+TEST(UGraphMinCut, stoerWagner)
+{
+    IntIntCsrGraph csr(makeStoerWagnerGraph());
+    GraphCut<int> cut = findMinCutStoerWagner(csr);
+    EXPECT_EQ(4, cut.value);
+    EXPECT_EQ(4, getCutValue(csr, cut.side));
+
+    std::vector<bool> expected = {false, false, true, true, false, false, true, true};
+    if(!cut.side[2])
+        cut.side.flip();
+    EXPECT_EQ(expected, cut.side);
+}
+
+TEST(UGraphMinCut, kargerStein)
+{
+    IntIntCsrGraph csr(makeStoerWagnerGraph());
+    GraphCut<int> cut = findMinCutKargerStein(csr, 50, 4);
+    EXPECT_EQ(4, cut.value);
+    EXPECT_EQ(4, getCutValue(csr, cut.side));
+}
+
+TEST(UGraphMinCut, disconnected)
+{
+    IntIntGraph g;
+    g.addLblEdge(1, 2, 5);
+    g.addLblEdge(3, 4, 5);
+    g.addLblEdge(3, 3, 1);
+
+    IntIntCsrGraph csr(g);
+    EXPECT_EQ(0, findMinCutStoerWagner(csr).value);
+    EXPECT_EQ(0, findMinCutKargerStein(csr, 10, 2).value);
+
+    IntIntGraph g1;
+    g1.addVertex(1);
+    EXPECT_THROW(findMinCutStoerWagner(IntIntCsrGraph(g1)), std::invalid_argument);
+}
+
+// Two dense random clusters joined by a few light edges.
+TEST(UGraphMinCut, twoClusters)
+{
+    IntIntGraph g;
+    std::mt19937 rnd(9);
+    std::uniform_int_distribution<int> pick(0, 29);
+    for(int c = 0; c < 2; ++c)
+        for(int i = 0; i < 200; ++i)
+            g.addLblEdge(c * 30 + pick(rnd), c * 30 + pick(rnd), 5);
+    g.addLblEdge(0, 30, 1);
+    g.addLblEdge(1, 31, 1);
+
+    IntIntCsrGraph csr(g);
+    GraphCut<int> sw = findMinCutStoerWagner(csr);
+    GraphCut<int> ks = findMinCutKargerStein(csr, 8, 4);
+    EXPECT_EQ(2, sw.value);
+    EXPECT_EQ(sw.value, ks.value);
+    EXPECT_EQ(ks.value, getCutValue(csr, ks.side));
+}
@@ -0,0 +1,225 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for graph partitioning.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+#include "ugraph/ugraph_partition.hpp"
+
+
+typedef EdgeLblUGraph<int, int> IntLblGraph;
+typedef CsrEdgeLblUGraph<int, int> IntCsrLblGraph;
+typedef CsrUGraph<int> IntCsrGraph;
+
+/// \a clusters dense random clusters of \a size vertices with \a bridges
+/// edges between them, vertices shuffled; edges labeled by their number.
+static IntLblGraph makeClusters(int clusters, int size, int bridges, unsigned seed)
+{
+    const int n = clusters * size;
+    std::vector<int> ids(n);
+    for(int i = 0; i < n; ++i)
+        ids[i] = i * 2;
+    std::mt19937 rnd(seed);
+    std::shuffle(ids.begin(), ids.end(), rnd);
+
+    IntLblGraph g;
+    std::uniform_int_distribution<int> pick(0, size - 1), cpick(0, clusters - 1);
+    int lbl = 0;
+    for(int c = 0; c < clusters; ++c)
+        for(int i = 0; i < size * 5; ++i)
+            g.addLblEdge(ids[c * size + pick(rnd)], ids[c * size + pick(rnd)], lbl++);
+    for(int i = 0; i < bridges; ++i)
+        g.addLblEdge(ids[cpick(rnd) * size + pick(rnd)], ids[cpick(rnd) * size + pick(rnd)],
+                     lbl++);
+
+    return g;
+}
+
+/// A \a size x \a size grid with vertices numbered by rows.
+static IntCsrGraph makeGrid(int size)
+{
+    UGraph<int> g;
+    for(int r = 0; r < size; ++r)
+        for(int c = 0; c < size; ++c)
+        {
+            if(c + 1 < size)
+                g.addEdge(r * size + c, r * size + c + 1);
+            if(r + 1 < size)
+                g.addEdge(r * size + c, (r + 1) * size + c);
+        }
+
+    return IntCsrGraph(g);
+}
+
+/// Checks the consistency of \a p and returns the largest part.
+template <typename TGraph>
+static size_t checkPartition(const TGraph& g, const GraphPartition& p, std::uint32_t k)
+{
+    EXPECT_EQ(k, p.partsNum);
+    EXPECT_EQ(g.getVerticesNum(), p.partIds.size());
+    std::vector<size_t> sizes(k, 0);
+    for(std::uint32_t part : p.partIds)
+    {
+        EXPECT_LT(part, k);
+        if(part < k)
+            ++sizes[part];
+    }
+    EXPECT_EQ(sizes, p.partSizes);
+    EXPECT_EQ(getCutEdgesNum(g, p.partIds), p.cutEdges);
+
+    return sizes.empty() ? 0 : *std::max_element(sizes.begin(), sizes.end());
+}
+
+/// The cut of the round-robin assignment, which is about that of a random one.
+static size_t getRoundRobinCut(const IntCsrLblGraph& g, std::uint32_t k)
+{
+    std::vector<std::uint32_t> ids(g.getVerticesNum());
+    for(size_t v = 0; v < ids.size(); ++v)
+        ids[v] = static_cast<std::uint32_t>(v % k);
+
+    return getCutEdgesNum(g, ids);
+}
+
+
+TEST(UGraphPartition, multilevel)
+{
+    IntCsrLblGraph g(makeClusters(8, 150, 60, 3));
+    GraphPartition p = partitionGraphMultilevel(g, 8);
+    EXPECT_LE(checkPartition(g, p, 8), 155u);          // 1.03 * 150 rounded up
+    EXPECT_LE(p.cutEdges, 120u);
+    EXPECT_LT(p.cutEdges * 20, getRoundRobinCut(g, 8));
+
+    // a grid is cut about along its rows or columns
+    IntCsrGraph grid = makeGrid(60);
+    for(std::uint32_t k : {2u, 4u, 7u})
+    {
+        GraphPartition gp = partitionGraphMultilevel(grid, k, 0.05);
+        EXPECT_LE(checkPartition(grid, gp, k),
+                  static_cast<size_t>(std::ceil(1.05 * 3600 / k)));
+        EXPECT_LE(gp.cutEdges, 60u * k) << k;
+    }
+
+    // the same seed, the same result
+    EXPECT_EQ(p.partIds, partitionGraphMultilevel(g, 8).partIds);
+
+    // corner cases
+    EXPECT_EQ(0u, partitionGraphMultilevel(g, 1).cutEdges);
+    IntLblGraph small;
+    small.addEdge(1, 2);
+    small.addEdge(2, 3);
+    IntCsrLblGraph sg(small);
+    checkPartition(sg, partitionGraphMultilevel(sg, 5), 5);
+    EXPECT_LE(checkPartition(sg, partitionGraphMultilevel(sg, 3), 3), 2u);
+    checkPartition(IntCsrGraph(), partitionGraphMultilevel(IntCsrGraph(), 3), 3);
+    EXPECT_THROW(partitionGraphMultilevel(g, 0), std::invalid_argument);
+}
+
+TEST(UGraphPartition, streaming)
+{
+    IntCsrLblGraph g(makeClusters(8, 150, 60, 5));
+    const size_t rr = getRoundRobinCut(g, 8);
+    IntCsrGraph grid = makeGrid(60);
+    for(StreamingObjective obj : {StreamingObjective::LDG, StreamingObjective::FENNEL})
+    {
+        GraphPartition p = partitionGraphStreaming(g, 8, obj, 0.1);
+        EXPECT_LE(checkPartition(g, p, 8), 165u);
+        EXPECT_LT(p.cutEdges * 3, rr * 2);
+
+        // a grid streamed by rows gets cut into bands
+        GraphPartition gp = partitionGraphStreaming(grid, 4, obj, 0.1);
+        EXPECT_LE(checkPartition(grid, gp, 4), static_cast<size_t>(std::ceil(1.1 * 3600 / 4)));
+        EXPECT_LE(gp.cutEdges, 600u);                       // 3540 by round robin
+    }
+
+    // one vertex at a time, neighbours not yet seen are skipped
+    StreamingPartitioner sp(2, 4, 3, StreamingObjective::LDG, 0);
+    std::vector<std::uint32_t> adj0 = {1, 2}, adj1 = {0, 0, 1}, adj2 = {1, 3}, adj3 = {2};
+    std::uint32_t p0 = sp.addVertex(0, adj0.begin(), adj0.end());
+    EXPECT_EQ(p0, sp.addVertex(1, adj1.begin(), adj1.end()));
+    EXPECT_THROW(sp.addVertex(1, adj1.begin(), adj1.end()), std::invalid_argument);
+    EXPECT_THROW(sp.addVertex(4, adj1.begin(), adj1.end()), std::invalid_argument);
+    EXPECT_NE(p0, sp.addVertex(3, adj3.begin(), adj3.end()));  // the part of 0 is full
+    EXPECT_EQ(static_cast<std::uint32_t>(-1), sp.getPart(2));
+    EXPECT_EQ(0u, sp.getPartition().cutEdges);
+    EXPECT_EQ(sp.getPart(3), sp.addVertex(2, adj2.begin(), adj2.end()));
+    EXPECT_EQ(1u, sp.getPartition().cutEdges);             // 0-2 was given with 0 only
+}
+
+TEST(UGraphPartition, parts)
+{
+    IntLblGraph lg = makeClusters(5, 80, 40, 7);
+    lg.addLblEdge(2, 2, -1);
+    lg.addVertex(10001);
+    IntCsrLblGraph g(lg);
+    GraphPartition p = partitionGraphMultilevel(g, 5);
+    std::vector<CsrEdgeLblUGraphPart<int, int>> parts = makeGraphParts(g, p, 2);
+    ASSERT_EQ(5u, parts.size());
+
+    std::vector<int> owned(g.getVerticesNum(), 0);
+    size_t edges = 0;
+    for(std::uint32_t i = 0; i < parts.size(); ++i)
+    {
+        const CsrEdgeLblUGraphPart<int, int>& sub = parts[i];
+        EXPECT_EQ(i, sub.getPart());
+        EXPECT_EQ(p.partSizes[i], sub.getOwnedNum());
+        ASSERT_EQ(sub.getOwnedNum() + sub.getGhostsNum(), sub.getVerticesNum());
+        edges += sub.getEdgesNum();
+        for(std::uint32_t v = 0; v < sub.getVerticesNum(); ++v)
+        {
+            std::uint32_t gv = sub.getGlobalId(v);
+            EXPECT_EQ(g.getVertex(gv), sub.getVertex(v));
+            EXPECT_EQ(p.partIds[gv], sub.getOwner(v));
+            std::uint32_t id;
+            ASSERT_TRUE(sub.getVId(sub.getVertex(v), id));
+            EXPECT_EQ(v, id);
+            if(sub.isGhost(v))
+            {
+                EXPECT_NE(i, sub.getOwner(v));
+                EXPECT_EQ(0u, sub.getDegree(v));
+                continue;
+            }
+
+            ++owned[gv];
+            ASSERT_EQ(g.getDegree(gv), sub.getDegree(v));
+            const int* lbls = sub.getAdjLabels(v);
+            for(const std::uint32_t* it = sub.getAdjVertices(v).first;
+                it != sub.getAdjVertices(v).second; ++it, ++lbls)
+            {
+                int lbl = 0;
+                ASSERT_TRUE(lg.getLabel(sub.getVertex(v), sub.getVertex(*it), lbl));
+                EXPECT_EQ(lbl, *lbls);
+            }
+        }
+    }
+    EXPECT_EQ(std::vector<int>(g.getVerticesNum(), 1), owned);
+    EXPECT_EQ(g.getEdgesNum() + p.cutEdges, edges);     // cut edges in both parts
+
+    // unlabeled
+    IntCsrGraph ug(g);
+    std::vector<CsrUGraphPart<int>> uparts = makeGraphParts(ug, p);
+    ASSERT_EQ(5u, uparts.size());
+    for(std::uint32_t i = 0; i < uparts.size(); ++i)
+    {
+        EXPECT_EQ(parts[i].getVerticesNum(), uparts[i].getVerticesNum());
+        EXPECT_EQ(parts[i].getEdgesNum(), uparts[i].getEdgesNum());
+    }
+
+    GraphPartition bad = p;
+    bad.partIds.pop_back();
+    EXPECT_THROW(CsrUGraphPart<int>(ug, bad, 0), std::invalid_argument);
+}
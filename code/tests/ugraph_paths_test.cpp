@@ -0,0 +1,123 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for shortest paths algorithms.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "ugraph/ugraph_paths.hpp"
+
+
+typedef EdgeLblUGraph<char, int> CharIntGraph;
+typedef CsrEdgeLblUGraph<char, int> CharIntCsrGraph;
+typedef EdgeLblUGraph<int, double> IntDblGraph;
+typedef CsrEdgeLblUGraph<int, double> IntDblCsrGraph;
+
+
+// Creates a graph from CLRS, figure 23.1.
+static CharIntGraph makeClrsGraph()
+{
+    CharIntGraph g;
+    g.addLblEdge('a', 'b', 4);
+    g.addLblEdge('b', 'c', 8);
+    g.addLblEdge('b', 'h', 11);
+    g.addLblEdge('c', 'd', 7);
+    g.addLblEdge('c', 'i', 2);
+    g.addLblEdge('c', 'f', 4);
+    g.addLblEdge('d', 'e', 9);
+    g.addLblEdge('d', 'f', 14);
+    g.addLblEdge('e', 'f', 10);
+    g.addLblEdge('f', 'g', 2);
+    g.addLblEdge('g', 'h', 1);
+    g.addLblEdge('g', 'i', 6);
+    g.addLblEdge('h', 'a', 8);
+    g.addLblEdge('h', 'i', 7);
+    return g;
+}
+
+TEST(CsrEdgeLblUGraph, labels)
+{
+    CharIntGraph g = makeClrsGraph();
+    g.addEdge('a', 'z');
+    CharIntCsrGraph csr(g, 100);
+
+    CharIntCsrGraph::VId a;
+    ASSERT_TRUE(csr.getVId('a', a));
+    CharIntCsrGraph::AdjIterPair adj = csr.getAdjVertices(a);
+    ASSERT_EQ(3, adj.second - adj.first);
+    EXPECT_EQ('b', csr.getVertex(adj.first[0]));
+    EXPECT_EQ(4, csr.getAdjLabels(a)[0]);
+    EXPECT_EQ(8, csr.getAdjLabels(a)[1]);
+    EXPECT_EQ(100, csr.getAdjLabels(a)[2]);     // unlabeled edge
+}
+
+TEST(UGraphPaths, dijkstraRadix)
+{
+    CharIntCsrGraph csr(makeClrsGraph());
+    CharIntCsrGraph::VId a, e;
+    ASSERT_TRUE(csr.getVId('a', a));
+    ASSERT_TRUE(csr.getVId('e', e));
+
+    auto sp = findShortestPathsDijkstra(csr, a);
+    EXPECT_EQ(0, sp.dists[a]);
+    EXPECT_EQ(21, sp.dists[e]);                 // a-h-g-f-e
+
+    std::string path;
+    for(CharIntCsrGraph::VId v = e; v != sp.noPred(); v = sp.preds[v])
+        path = csr.getVertex(v) + path;
+    EXPECT_EQ("ahgfe", path);
+}
+
+TEST(UGraphPaths, dijkstraBinaryHeap)
+{
+    IntDblGraph g;
+    g.addLblEdge(1, 2, 0.5);
+    g.addLblEdge(2, 3, 0.25);
+    g.addLblEdge(1, 3, 1.0);
+    g.addVertex(4);
+
+    IntDblCsrGraph csr(g);
+    auto sp = findShortestPathsDijkstra(csr, 0);
+    EXPECT_DOUBLE_EQ(0.75, sp.dists[2]);
+    EXPECT_EQ(1, sp.preds[2]);
+    EXPECT_EQ(sp.infinity(), sp.dists[3]);
+}
+
+TEST(UGraphPaths, negativeLabel)
+{
+    CharIntGraph g;
+    g.addLblEdge('a', 'b', -1);
+    CharIntCsrGraph csr(g);
+    EXPECT_THROW(findShortestPathsDijkstra(csr, 0), std::invalid_argument);
+}
+
+// Compares delta-stepping with Dijkstra on a random graph.
+TEST(UGraphPaths, deltaStepping)
+{
+    const int n = 2000;
+    EdgeLblUGraph<int, int> g;
+    std::mt19937 rnd(7);
+    std::uniform_int_distribution<int> pick(0, n - 1);
+    std::uniform_int_distribution<int> len(1, 100);
+    for(int i = 0; i < n * 4; ++i)
+        g.addLblEdge(pick(rnd), pick(rnd), len(rnd));
+
+    CsrEdgeLblUGraph<int, int> csr(g);
+    auto sp = findShortestPathsDijkstra(csr, 0);
+    for(int delta : {1, 30, 1000})
+    {
+        std::vector<int> ds = findDistancesDeltaStepping(csr, 0, delta, 4);
+        EXPECT_EQ(sp.dists, ds);
+    }
+}
@@ -0,0 +1,232 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for vertex reordering.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+
+#include "ugraph/compressed_ugraph.hpp"
+#include "ugraph/csr_lbl_ugraph.hpp"
+#include "ugraph/ugraph_bfs.hpp"
+#include "ugraph/ugraph_reorder.hpp"
+
+
+typedef UGraph<int> IntGraph;
+typedef CsrUGraph<int> IntCsrGraph;
+typedef IntCsrGraph::VId VId;
+
+/// Vertices 0..n-1 labeled by a random permutation, so that dense ids
+/// follow no structure.
+static std::vector<int> makeShuffle(int n, unsigned seed)
+{
+    std::vector<int> ids(n);
+    for(int i = 0; i < n; ++i)
+        ids[i] = i;
+    std::shuffle(ids.begin(), ids.end(), std::mt19937(seed));
+
+    return ids;
+}
+
+/// Sum of |id(u) - id(v)| over edges, and the largest one in \a band.
+static size_t getGaps(const IntCsrGraph& g, size_t& band)
+{
+    size_t sum = 0;
+    band = 0;
+    for(VId v = 0; v < g.getVerticesNum(); ++v)
+        for(const VId* it = g.getAdjVertices(v).first; it != g.getAdjVertices(v).second; ++it)
+        {
+            size_t gap = *it > v ? *it - v : v - *it;
+            sum += gap;
+            band = std::max(band, gap);
+        }
+
+    return sum;
+}
+
+static void expectPermutation(const std::vector<VId>& newIds, size_t n)
+{
+    ASSERT_EQ(n, newIds.size());
+    std::vector<VId> sorted(newIds);
+    std::sort(sorted.begin(), sorted.end());
+    for(size_t i = 0; i < n; ++i)
+        ASSERT_EQ(i, sorted[i]);
+}
+
+/// Checks that \a r is \a g with the dense ids permuted by \a newIds.
+template <typename TGraph>
+static void expectReordered(const IntCsrGraph& g, const std::vector<VId>& newIds,
+                            const TGraph& r)
+{
+    ASSERT_EQ(g.getVerticesNum(), r.getVerticesNum());
+    EXPECT_EQ(g.getEdgesNum(), r.getEdgesNum());
+    for(VId v = 0; v < g.getVerticesNum(); ++v)
+    {
+        VId u = newIds[v];
+        EXPECT_EQ(g.getVertex(v), r.getVertex(u));
+        VId id;
+        ASSERT_TRUE(r.getVId(g.getVertex(v), id));
+        EXPECT_EQ(u, id);
+
+        std::vector<VId> exp;
+        for(const VId* it = g.getAdjVertices(v).first; it != g.getAdjVertices(v).second; ++it)
+            exp.push_back(newIds[*it]);
+        std::sort(exp.begin(), exp.end());
+        typename TGraph::AdjIterPair adj = r.getAdjVertices(u);
+        ASSERT_EQ(exp, std::vector<VId>(adj.first, adj.second));
+    }
+    VId id;
+    EXPECT_FALSE(r.getVId(-1, id));
+}
+
+/// A random graph of a few components with self-loops and isolated vertices.
+static IntGraph makeRandom(int n, unsigned seed)
+{
+    std::vector<int> ids = makeShuffle(n, seed);
+    std::mt19937 rnd(seed);
+    std::uniform_int_distribution<int> pick(0, n / 3 - 1);
+    IntGraph g;
+    for(int i = 0; i < n; ++i)
+        g.addVertex(ids[i] * 2);
+    for(int c = 0; c < 3; ++c)
+        for(int i = 0; i < n; ++i)
+            g.addEdge(ids[c * (n / 3) + pick(rnd)] * 2, ids[c * (n / 3) + pick(rnd)] * 2);
+
+    return g;
+}
+
+
+TEST(UGraphReorder, permutations)
+{
+    IntCsrGraph g(makeRandom(600, 3));
+    for(const std::vector<VId>& newIds : {findDegreeOrder(g), findRcmOrder(g),
+                                          findGorderOrder(g), findGorderOrder(g, 1)})
+    {
+        expectPermutation(newIds, g.getVerticesNum());
+        expectReordered(g, newIds, IntCsrGraph(g, newIds, 2));
+    }
+
+    IntCsrGraph e;
+    EXPECT_TRUE(findDegreeOrder(e).empty());
+    EXPECT_TRUE(findRcmOrder(e).empty());
+    EXPECT_TRUE(findGorderOrder(e).empty());
+
+    std::vector<VId> bad(g.getVerticesNum(), 0);
+    EXPECT_THROW(IntCsrGraph(g, bad), std::invalid_argument);
+    bad.pop_back();
+    EXPECT_THROW(IntCsrGraph(g, bad), std::invalid_argument);
+}
+
+TEST(UGraphReorder, degree)
+{
+    IntCsrGraph g(makeRandom(300, 5));
+    IntCsrGraph r(g, findDegreeOrder(g));
+    for(VId v = 1; v < r.getVerticesNum(); ++v)
+        EXPECT_GE(r.getDegree(v - 1), r.getDegree(v));
+}
+
+TEST(UGraphReorder, rcm)
+{
+    // a shuffled path gets the bandwidth of 1
+    const int n = 500;
+    std::vector<int> ids = makeShuffle(n, 7);
+    IntGraph path;
+    for(int i = 0; i + 1 < n; ++i)
+        path.addEdge(ids[i], ids[i + 1]);
+    IntCsrGraph pg(path);
+    size_t band;
+    getGaps(IntCsrGraph(pg, findRcmOrder(pg)), band);
+    EXPECT_EQ(1u, band);
+
+    // a shuffled 30x30 grid: about its width
+    ids = makeShuffle(900, 9);
+    IntGraph grid;
+    for(int r = 0; r < 30; ++r)
+        for(int c = 0; c < 30; ++c)
+        {
+            if(c + 1 < 30)
+                grid.addEdge(ids[r * 30 + c], ids[r * 30 + c + 1]);
+            if(r + 1 < 30)
+                grid.addEdge(ids[r * 30 + c], ids[(r + 1) * 30 + c]);
+        }
+    IntCsrGraph gg(grid);
+    size_t before = getGaps(gg, band);
+    EXPECT_GT(band, 300u);
+    size_t after = getGaps(IntCsrGraph(gg, findRcmOrder(gg)), band);
+    EXPECT_LE(band, 31u);
+    EXPECT_LT(after * 10, before);
+}
+
+TEST(UGraphReorder, gorder)
+{
+    // shuffled cliques get together
+    std::vector<int> ids = makeShuffle(400, 11);
+    IntGraph g;
+    for(int c = 0; c < 40; ++c)
+        for(int i = 0; i < 10; ++i)
+            for(int j = i + 1; j < 10; ++j)
+                g.addEdge(ids[c * 10 + i], ids[c * 10 + j]);
+    g.addEdge(ids[0], ids[399]);
+
+    IntCsrGraph csr(g);
+    size_t band;
+    size_t before = getGaps(csr, band);
+    size_t after = getGaps(IntCsrGraph(csr, findGorderOrder(csr)), band);
+    EXPECT_LT(after * 10, before);
+}
+
+TEST(UGraphReorder, reorderedGraphs)
+{
+    IntGraph g = makeRandom(900, 13);
+    IntCsrGraph csr(g);
+    std::vector<VId> newIds = findGorderOrder(csr);
+    IntCsrGraph r(csr, newIds);
+    EXPECT_FALSE(r.getVertexIndex().empty());
+
+    // reordering twice composes the permutations
+    std::vector<VId> rcm = findRcmOrder(r), both(newIds.size());
+    for(size_t v = 0; v < newIds.size(); ++v)
+        both[v] = rcm[newIds[v]];
+    expectReordered(csr, both, IntCsrGraph(r, rcm));
+
+    // the same distances from the same vertex
+    VId src = 17;
+    std::vector<std::uint32_t> ds = findBfsDistances(csr, src);
+    std::vector<std::uint32_t> rds = findBfsDistances(r, newIds[src]);
+    for(VId v = 0; v < csr.getVerticesNum(); ++v)
+        ASSERT_EQ(ds[v], rds[newIds[v]]);
+
+    // compressed
+    expectReordered(csr, newIds, CompressedUGraph<int>(r));
+
+    // labels follow their edges
+    EdgeLblUGraph<int, int> lg;
+    for(int i = 0; i < 300; ++i)
+        lg.addLblEdge(i * 7 % 100, i * 13 % 100, i);
+    lg.addEdge(5, 5);
+    CsrEdgeLblUGraph<int, int> lcsr(lg, -1);
+    CsrEdgeLblUGraph<int, int> lr(lcsr, findRcmOrder(lcsr));
+    for(VId v = 0; v < lr.getVerticesNum(); ++v)
+    {
+        const int* lbls = lr.getAdjLabels(v);
+        for(const VId* it = lr.getAdjVertices(v).first; it != lr.getAdjVertices(v).second;
+            ++it, ++lbls)
+        {
+            int exp = -1;
+            lg.getLabel(lr.getVertex(v), lr.getVertex(*it), exp);
+            ASSERT_EQ(exp, *lbls);
+        }
+    }
+}
@@ -14,6 +14,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "ugraph/ugraph.hpp"
 
 
@@ -157,3 +159,90 @@ TEST(UGraph, iterEdges2)
     EXPECT_EQ(6, c);
 }
 
+
+// Tests maintained degrees of vertices, including self-loops.
+TEST(UGraph, getDegree1)
+{
+    IntGraph g;
+    g.addEdge(1, 2);
+    g.addEdge(1, 3);
+    g.addEdge(2, 1);                    // already exists
+    g.addEdge(2, 2);
+    g.addVertex(5);
+    g.addVertex(1);                     // already exists
+
+    EXPECT_EQ(2, g.getDegree(1));
+    EXPECT_EQ(2, g.getDegree(2));       // a self-loop counts once
+    EXPECT_EQ(1, g.getDegree(3));
+    EXPECT_EQ(0, g.getDegree(5));
+    EXPECT_EQ(0, g.getDegree(42));      // no such vertex
+}
+
+// Tests the statistics of degrees.
+TEST(UGraph, getDegreeStats1)
+{
+    IntGraph g;
+    DegreeStats st = g.getDegreeStats();
+    EXPECT_EQ(0, st.minDegree);
+    EXPECT_EQ(0, st.maxDegree);
+    EXPECT_TRUE(st.histogram.empty());
+
+    g.addEdge(1, 2);
+    g.addEdge(1, 3);
+    g.addEdge(1, 4);
+    g.addEdge(4, 4);
+    g.addVertex(5);
+
+    st = g.getDegreeStats();
+    EXPECT_EQ(0, st.minDegree);
+    EXPECT_EQ(3, st.maxDegree);
+    EXPECT_DOUBLE_EQ(7.0 / 5, st.meanDegree);
+    std::vector<size_t> expected = {1, 2, 1, 1};
+    EXPECT_EQ(expected, st.histogram);
+}
+
+// Compares the structure of two graphs.
+static void expectSameGraphs(const IntGraph& exp, const IntGraph& g)
+{
+    std::vector<int> ev(exp.getVertices().first, exp.getVertices().second);
+    std::vector<int> gv(g.getVertices().first, g.getVertices().second);
+    EXPECT_EQ(ev, gv);
+    for(int v : ev)
+        EXPECT_EQ(exp.getDegree(v), g.getDegree(v));
+
+    std::vector<std::pair<int, int>> ee, ge;
+    for(IntGraph::EdgeIter it = exp.getEdges().first; it != exp.getEdges().second; ++it)
+        ee.push_back(*it);
+    for(IntGraph::EdgeIter it = g.getEdges().first; it != g.getEdges().second; ++it)
+        ge.push_back(*it);
+    std::sort(ee.begin(), ee.end());
+    std::sort(ge.begin(), ge.end());
+    EXPECT_EQ(ee, ge);
+    EXPECT_EQ(exp.getEdgesNum(), g.getEdgesNum());
+}
+
+// Tests adding vertices and edges by batches.
+TEST(UGraph, addEdges1)
+{
+    std::vector<IntGraph::Edge> batch1 = {{3, 1}, {1, 2}, {2, 2}, {1, 3}, {4, 4},
+                                          {2, 2}, {5, 1}};
+    std::vector<IntGraph::Edge> batch2 = {{2, 2}, {1, 6}, {6, 6}, {3, 2}, {1, 2}};
+
+    IntGraph exp, g;
+    for(const IntGraph::Edge& e : batch1)
+        exp.addEdge(e.first, e.second);
+    exp.addVertex(7);
+    exp.addVertex(1);
+    for(const IntGraph::Edge& e : batch2)
+        exp.addEdge(e.first, e.second);
+
+    g.addEdges(batch1);                 // to an empty graph
+    g.addVertices({7, 1, 7});
+    g.addEdges(batch2);                 // to a non-empty one
+    expectSameGraphs(exp, g);
+    EXPECT_EQ(1, g.getDegree(4));
+    EXPECT_EQ(0, g.getDegree(7));
+
+    g.addEdges({});
+    expectSameGraphs(exp, g);
+}
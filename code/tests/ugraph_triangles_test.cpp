@@ -0,0 +1,78 @@
+///////////////////////////////////////////////////////////////////////////////
+/// \file
+/// \brief Testing module for triangle counting.
+///
+/// © Sergey Shershakov 2020.
+///
+/// This code is for educational purposes of the course "Algorithms and Data
+/// Structures" provided by the School of Software Engineering of the Faculty
+/// of Computer Science at the Higher School of Economics.
+///
+/// When altering code, a copyright line must be preserved.
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "ugraph/ugraph_triangles.hpp"
+
+
+typedef UGraph<int> IntGraph;
+typedef CsrUGraph<int> IntCsrGraph;
+
+
+// K4 with a pendant vertex and a self-loop.
+TEST(UGraphTriangles, k4)
+{
+    IntGraph g;
+    for(int i = 0; i < 4; ++i)
+        for(int j = i + 1; j < 4; ++j)
+            g.addEdge(i, j);
+    g.addEdge(3, 4);
+    g.addEdge(0, 0);
+
+    IntCsrGraph csr(g);
+    TriangleCounts tc = countTriangles(csr, 2);
+    EXPECT_EQ(4, tc.total);
+    std::vector<std::uint64_t> expected = {3, 3, 3, 3, 0};
+    EXPECT_EQ(expected, tc.perVertex);
+
+    std::vector<double> cc = getClusteringCoefficients(csr, tc);
+    EXPECT_DOUBLE_EQ(1.0, cc[0]);
+    EXPECT_DOUBLE_EQ(1.0, cc[1]);
+    EXPECT_DOUBLE_EQ(0.5, cc[3]);
+    EXPECT_DOUBLE_EQ(0.0, cc[4]);
+}
+
+// Compares with brute force on a random graph dense enough for SIMD blocks.
+TEST(UGraphTriangles, random)
+{
+    const int n = 200;
+    IntGraph g;
+    std::mt19937 rnd(3);
+    std::uniform_int_distribution<int> pick(0, n - 1);
+    for(int i = 0; i < n * 15; ++i)
+        g.addEdge(pick(rnd), pick(rnd));
+
+    IntCsrGraph csr(g);
+    std::vector<std::uint64_t> expected(csr.getVerticesNum(), 0);
+    std::uint64_t total = 0;
+    for(IntCsrGraph::VId a = 0; a < csr.getVerticesNum(); ++a)
+        for(IntCsrGraph::VId b = a + 1; b < csr.getVerticesNum(); ++b)
+            for(IntCsrGraph::VId c = b + 1; c < csr.getVerticesNum(); ++c)
+                if(g.isEdgeExists(csr.getVertex(a), csr.getVertex(b))
+                        && g.isEdgeExists(csr.getVertex(b), csr.getVertex(c))
+                        && g.isEdgeExists(csr.getVertex(a), csr.getVertex(c)))
+                {
+                    ++expected[a];
+                    ++expected[b];
+                    ++expected[c];
+                    ++total;
+                }
+
+    TriangleCounts tc = countTriangles(csr, 3);
+    EXPECT_EQ(total, tc.total);
+    EXPECT_EQ(expected, tc.perVertex);
+}